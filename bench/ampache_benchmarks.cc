@@ -0,0 +1,123 @@
+// ampache_benchmarks.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <functional>
+
+#include <QEventLoop>
+
+#include "infrastructure/event/event.h"
+#include "infrastructure/event/delegate.h"
+#include "src/data/data_objects/artist_data.h"
+#include "src/data/data_objects/album_data.h"
+#include "src/data/data_objects/track_data.h"
+#include "data/providers/ampache/ampache.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "ampache_fixture.h"
+#include "benchmarks.h"
+
+using namespace infrastructure;
+using namespace data;
+
+
+
+namespace bench {
+
+// number of records requested by a single request
+static const int PAGE_SIZE = 5000;
+
+
+
+static std::string readFile(const std::string& path) {
+    std::ifstream stream{path, std::ios::binary};
+    std::ostringstream content;
+    content << stream.rdbuf();
+    return content.str();
+}
+
+
+
+static void writeFile(const std::string& path, const std::string& content) {
+    std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+    stream << content;
+}
+
+
+
+// requests pages until the given number of records is parsed or the server does not return any records
+template <typename T>
+static int parseResponses(Event<ReadyData<T>>& readyEvent, const std::function<void(int, int)>& requestFn,
+    int numberOfRecords) {
+
+    int numberOfParsedRecords = 0;
+    while (numberOfParsedRecords < numberOfRecords) {
+        QEventLoop eventLoop;
+        int pageSize = 0;
+        auto onReady = Delegate<ReadyData<T>>{"parseResponses", &eventLoop, [&](ReadyData<T>& readyData) {
+            pageSize = readyData.error ? 0 : static_cast<int>(readyData.data.size());
+            eventLoop.quit();
+        }};
+        readyEvent += onReady;
+        requestFn(numberOfParsedRecords, PAGE_SIZE);
+        eventLoop.exec();
+        readyEvent -= onReady;
+
+        if (pageSize == 0) {
+            break;
+        }
+        numberOfParsedRecords += pageSize;
+    }
+    return numberOfParsedRecords;
+}
+
+
+
+void recordAmpacheResponses(const SyntheticLibrary& library, const std::string& responsesDir) {
+    writeFile(responsesDir + "artists.xml", library.createArtistsXml(0, PAGE_SIZE));
+    writeFile(responsesDir + "albums.xml", library.createAlbumsXml(0, PAGE_SIZE));
+    writeFile(responsesDir + "songs.xml", library.createTracksXml(0, PAGE_SIZE));
+}
+
+
+
+void runAmpacheBenchmarks(const SyntheticLibrary& library, const std::string& responsesDir) {
+    std::map<std::string, std::string> responses{
+        {"artists", readFile(responsesDir + "artists.xml")},
+        {"albums", readFile(responsesDir + "albums.xml")},
+        {"songs", readFile(responsesDir + "songs.xml")}};
+
+    // the same recorded response is returned for every offset
+    AmpacheFixture ampacheFixture{library, [&responses](const std::string& methodName, int) {
+        return responses[methodName];
+    }};
+    ampacheFixture.initialize();
+    auto& ampache = ampacheFixture.getAmpache();
+
+    Benchmark::run("ampache parse artists", [&]() {
+        return parseResponses(ampache.readyArtists, [&ampache](int offset, int limit) {
+            ampache.requestArtists(offset, limit);
+        }, library.numberOfArtists());
+    });
+    Benchmark::run("ampache parse albums", [&]() {
+        return parseResponses(ampache.readyAlbums, [&ampache](int offset, int limit) {
+            ampache.requestAlbums(offset, limit);
+        }, library.numberOfAlbums());
+    });
+    Benchmark::run("ampache parse tracks", [&]() {
+        return parseResponses(ampache.readyTracks, [&ampache](int offset, int limit) {
+            ampache.requestTracks(offset, limit);
+        }, library.numberOfTracks());
+    });
+}
+
+}
@@ -0,0 +1,124 @@
+// ampache_browser_bench.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <QtGlobal>
+#include <QApplication>
+#include <QDir>
+
+#include "infrastructure/logging/logging.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "benchmarks.h"
+
+using namespace infrastructure;
+using namespace bench;
+
+
+
+static void printUsage(const char* program) {
+    printf("Usage: %s [OPTION...] [NUMBER_OF_TRACKS...]\n\n"
+        "Benchmarks performance critical code with synthetic libraries of the given sizes (10000, 100000 and 1000000\n"
+        "tracks by default).\n\n"
+        "  --responses DIR    Parse responses recorded in DIR/artists.xml, DIR/albums.xml and DIR/songs.xml instead\n"
+        "                     of the synthetic ones.\n"
+        "  --latency MS       Delay of responses of the fake server in the end-to-end benchmark (0 by default).\n"
+        "  --bandwidth BYTES  Transfer rate of responses of the fake server in the end-to-end benchmark in bytes per\n"
+        "                     second (unlimited by default).\n"
+        "  --end-to-end-only  Run only the end-to-end benchmark.\n", program);
+}
+
+
+
+static bool isNumber(const std::string& str) {
+    return !str.empty() && str.find_first_not_of("0123456789") == std::string::npos;
+}
+
+
+
+int main(int argc, char** argv) {
+
+    // the end-to-end benchmark creates the application window; it is not displayed
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication application{argc, argv};
+    SET_LOG_LEVEL(LogLevel::Warning);
+
+    std::string responsesDir;
+    int latency = 0;
+    int bandwidth = 0;
+    bool isEndToEndOnly = false;
+    std::vector<int> librarySizes;
+    for (int argIdx = 1; argIdx < argc; argIdx++) {
+        std::string arg{argv[argIdx]};
+        std::string value{argIdx + 1 < argc ? argv[argIdx + 1] : ""};
+        if (arg == "--responses" && !value.empty()) {
+            responsesDir = value + "/";
+            argIdx++;
+        } else if (arg == "--latency" && isNumber(value)) {
+            latency = std::stoi(value);
+            argIdx++;
+        } else if (arg == "--bandwidth" && isNumber(value)) {
+            bandwidth = std::stoi(value);
+            argIdx++;
+        } else if (arg == "--end-to-end-only") {
+            isEndToEndOnly = true;
+        } else if (isNumber(arg)) {
+            librarySizes.push_back(std::stoi(arg));
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (librarySizes.empty()) {
+        librarySizes = {10000, 100000, 1000000};
+    }
+
+    // cache is stored to a temporary directory instead of the user's one
+    char workDirTemplate[] = "/tmp/ampache_browser_bench.XXXXXX";
+    if (mkdtemp(workDirTemplate) == nullptr) {
+        perror("Unable to create working directory");
+        return 1;
+    }
+    std::string workDir{workDirTemplate};
+    setenv("XDG_CACHE_HOME", workDir.c_str(), 1);
+
+    for (auto librarySize: librarySizes) {
+        SyntheticLibrary library{librarySize};
+        printf("\nLibrary of %d artists, %d albums and %d tracks\n\n", library.numberOfArtists(),
+            library.numberOfAlbums(), library.numberOfTracks());
+        Benchmark::printHeader();
+
+        if (!isEndToEndOnly) {
+            runCacheBenchmarks(library);
+            if (responsesDir.empty()) {
+                recordAmpacheResponses(library, workDir + "/");
+                runAmpacheBenchmarks(library, workDir + "/");
+            } else {
+                runAmpacheBenchmarks(library, responsesDir);
+            }
+            runRepositoryBenchmarks(library);
+            runIndicesBenchmarks(library);
+            runFilterBenchmarks(library);
+            runRequestsBenchmarks(library);
+        }
+
+        // start with an empty cache
+        QDir{QString::fromStdString(workDir + "/ampache_browser")}.removeRecursively();
+        runEndToEndBenchmarks(library, latency, bandwidth);
+    }
+
+    QDir{QString::fromStdString(workDir)}.removeRecursively();
+    return 0;
+}
@@ -0,0 +1,82 @@
+// ampache_fixture.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <string>
+#include <functional>
+#include <memory>
+
+#include <QEventLoop>
+#include <QTimer>
+
+#include "infrastructure/event/delegate.h"
+#include "data/providers/connection_info.h"
+#include "src/data/providers/ampache/ampache_url.h"
+#include "data/providers/ampache/ampache.h"
+#include "synthetic_library.h"
+#include "ampache_fixture.h"
+
+using namespace std::placeholders;
+using namespace infrastructure;
+using namespace data;
+
+
+
+namespace bench {
+
+AmpacheFixture::AmpacheFixture(const SyntheticLibrary& library, const ResponseFn& responseFn):
+myLibrary{library},
+myResponseFn{responseFn},
+myConnectionInfo{new ConnectionInfo{"http://bench.invalid", "bench", "bench", "", 0, "", ""}},
+myAmpache{new Ampache{*myConnectionInfo, bind(&AmpacheFixture::onNetworkRequest, this, _1, _2), 100,
+    library.getArtistIds(), library.getAlbumIds()}} {
+}
+
+
+
+AmpacheFixture::~AmpacheFixture() = default;
+
+
+
+void AmpacheFixture::initialize() {
+    QEventLoop eventLoop;
+    auto onInitialized = Delegate<bool>{"AmpacheFixture::initialize", this, [&eventLoop](bool&) {
+        eventLoop.quit();
+    }};
+    myAmpache->initialized += onInitialized;
+    myAmpache->initialize();
+    eventLoop.exec();
+    myAmpache->initialized -= onInitialized;
+}
+
+
+
+Ampache& AmpacheFixture::getAmpache() {
+    return *myAmpache;
+}
+
+
+
+void AmpacheFixture::onNetworkRequest(const std::string& url, Ampache::NetworkRequestCb& networkRequestCb) {
+    AmpacheUrl ampacheUrl{url};
+    auto methodName = ampacheUrl.parseActionValue();
+    auto offsetValue = ampacheUrl.parseOffsetValue();
+    int offset = offsetValue.empty() ? 0 : std::stoi(offsetValue);
+
+    auto content = methodName == "handshake" ? myLibrary.createHandshakeXml() : myResponseFn(methodName, offset);
+    if (content.empty()) {
+        return;
+    }
+
+    // respond asynchronously as the real network does
+    QTimer::singleShot(0, [url, content, &networkRequestCb]() {
+        networkRequestCb(url, content.data(), static_cast<int>(content.size()));
+    });
+}
+
+}
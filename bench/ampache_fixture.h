@@ -0,0 +1,82 @@
+// ampache_fixture.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef AMPACHEFIXTURE_H
+#define AMPACHEFIXTURE_H
+
+
+
+#include <string>
+#include <functional>
+#include <memory>
+
+#include "data/providers/ampache/ampache.h"
+
+namespace data {
+class ConnectionInfo;
+}
+
+
+
+namespace bench {
+
+class SyntheticLibrary;
+
+
+
+/**
+ * @brief Ampache service connected to a fake server which serves responses without any network I/O.
+ */
+class AmpacheFixture {
+
+public:
+    /**
+     * @brief Function that returns the response to the given method called from the given offset.
+     *
+     * An empty string means that the server shall not respond at all.
+     */
+    using ResponseFn = std::function<std::string(const std::string& methodName, int offset)>;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param library The library the fake server reports in the handshake response.
+     * @param responseFn Provides responses to methods other than handshake.
+     */
+    explicit AmpacheFixture(const SyntheticLibrary& library, const ResponseFn& responseFn);
+
+    ~AmpacheFixture();
+
+    AmpacheFixture(const AmpacheFixture& other) = delete;
+
+    AmpacheFixture& operator=(const AmpacheFixture& other) = delete;
+
+    /**
+     * @brief Performs handshake with the fake server and waits until it finishes.
+     */
+    void initialize();
+
+    data::Ampache& getAmpache();
+
+private:
+    // arguments from the constructor
+    const SyntheticLibrary& myLibrary;
+    const ResponseFn myResponseFn;
+
+    const std::unique_ptr<data::ConnectionInfo> myConnectionInfo;
+    const std::unique_ptr<data::Ampache> myAmpache;
+
+    void onNetworkRequest(const std::string& url, data::Ampache::NetworkRequestCb& networkRequestCb);
+};
+
+}
+
+
+
+#endif // AMPACHEFIXTURE_H
@@ -0,0 +1,53 @@
+// benchmark.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include <chrono>
+#include <string>
+#include <functional>
+
+#include "benchmark.h"
+
+
+
+namespace bench {
+
+void Benchmark::printHeader() {
+    printf("%-40s %10s %12s %14s %14s\n", "benchmark", "items", "time [ms]", "items/s", "peak mem [MiB]");
+}
+
+
+
+void Benchmark::run(const std::string& name, const std::function<int()>& function) {
+    auto begin = std::chrono::steady_clock::now();
+    int numberOfItems = function();
+    auto end = std::chrono::steady_clock::now();
+
+    report(name, numberOfItems, std::chrono::duration<double>(end - begin).count());
+}
+
+
+
+void Benchmark::report(const std::string& name, int numberOfItems, double seconds) {
+    double itemsPerSecond = seconds > 0 ? numberOfItems / seconds : 0;
+    printf("%-40s %10d %12.1f %14.0f %14.1f\n", name.c_str(), numberOfItems, seconds * 1000, itemsPerSecond,
+        getPeakMemoryKb() / 1024.0);
+    fflush(stdout);
+}
+
+
+
+long Benchmark::getPeakMemoryKb() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+}
@@ -0,0 +1,61 @@
+// benchmark.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+
+
+#include <string>
+#include <functional>
+
+
+
+namespace bench {
+
+/**
+ * @brief Measures and reports the duration of an operation.
+ */
+class Benchmark {
+
+public:
+    /**
+     * @brief Prints the header of the table of results.
+     */
+    static void printHeader();
+
+    /**
+     * @brief Runs the given function once and prints its throughput and the peak memory usage.
+     *
+     * The peak memory is the maximal resident set size of the whole process so far; it therefore includes the
+     * memory used by previously run benchmarks.
+     *
+     * @param name Name of the benchmark.
+     * @param function The benchmarked operation.  Returns the number of processed items.
+     */
+    static void run(const std::string& name, const std::function<int()>& function);
+
+    /**
+     * @brief Prints throughput of an operation measured elsewhere and the peak memory usage.
+     *
+     * @param name Name of the benchmark.
+     * @param numberOfItems Number of items processed by the operation.
+     * @param seconds Duration of the operation.
+     */
+    static void report(const std::string& name, int numberOfItems, double seconds);
+
+private:
+    static long getPeakMemoryKb();
+};
+
+}
+
+
+
+#endif // BENCHMARK_H
@@ -0,0 +1,82 @@
+// benchmarks.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+
+
+#include <string>
+
+
+
+namespace bench {
+
+class SyntheticLibrary;
+
+
+
+/**
+ * @brief Benchmarks saving and loading of the disk cache.
+ */
+void runCacheBenchmarks(const SyntheticLibrary& library);
+
+/**
+ * @brief Records responses of the Ampache server for runAmpacheBenchmarks().
+ *
+ * @param library The library the responses are recorded from.
+ * @param responsesDir Directory where the responses shall be stored.
+ */
+void recordAmpacheResponses(const SyntheticLibrary& library, const std::string& responsesDir);
+
+/**
+ * @brief Benchmarks parsing of responses of the Ampache server.
+ *
+ * @param library The library the responses are recorded from.
+ * @param responsesDir Directory with recorded responses to artists, albums and songs methods; they are stored in
+ *        artists.xml, albums.xml and songs.xml files.
+ */
+void runAmpacheBenchmarks(const SyntheticLibrary& library, const std::string& responsesDir);
+
+/**
+ * @brief Benchmarks processing of data loaded from the server by repositories.
+ */
+void runRepositoryBenchmarks(const SyntheticLibrary& library);
+
+/**
+ * @brief Benchmarks updates of indices.
+ */
+void runIndicesBenchmarks(const SyntheticLibrary& library);
+
+/**
+ * @brief Benchmarks all filters.
+ */
+void runFilterBenchmarks(const SyntheticLibrary& library);
+
+/**
+ * @brief Benchmarks scheduling of requests of models.
+ */
+void runRequestsBenchmarks(const SyntheticLibrary& library);
+
+/**
+ * @brief Benchmarks loading of the whole application from a fake server, with empty and with filled cache.
+ *
+ * Reports the time until the first row of each view is loaded and the time until all data are loaded.
+ *
+ * @param library The library served by the fake server.
+ * @param latency Delay of each response of the fake server in milliseconds.
+ * @param bandwidth Transfer rate of a response of the fake server in bytes per second.  0 if unlimited.
+ */
+void runEndToEndBenchmarks(const SyntheticLibrary& library, int latency, int bandwidth);
+
+}
+
+
+
+#endif // BENCHMARKS_H
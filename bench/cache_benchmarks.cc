@@ -0,0 +1,65 @@
+// cache_benchmarks.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <vector>
+#include <memory>
+
+#include "src/data/data_objects/artist_data.h"
+#include "src/data/data_objects/album_data.h"
+#include "src/data/data_objects/track_data.h"
+#include "data/providers/cache.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "benchmarks.h"
+
+using namespace data;
+
+
+
+namespace bench {
+
+void runCacheBenchmarks(const SyntheticLibrary& library) {
+    auto artistsData = library.createArtistsData();
+    auto albumsData = library.createAlbumsData();
+    auto tracksData = library.createTracksData();
+    Cache cache{"http://bench.invalid", "bench", library.getArtistIds(), library.getAlbumIds()};
+
+    Benchmark::run("cache save artists", [&]() {
+        cache.saveArtistsData(artistsData);
+        return static_cast<int>(artistsData.size());
+    });
+    Benchmark::run("cache save albums", [&]() {
+        cache.saveAlbumsData(albumsData);
+        return static_cast<int>(albumsData.size());
+    });
+    Benchmark::run("cache save tracks", [&]() {
+        cache.saveTracksData(tracksData);
+        return static_cast<int>(tracksData.size());
+    });
+
+    // free the memory before loading so that the peak memory of loading is not affected
+    artistsData.clear();
+    albumsData.clear();
+    tracksData.clear();
+
+    Benchmark::run("cache load artists", [&]() {
+        artistsData = cache.loadArtistsData();
+        return static_cast<int>(artistsData.size());
+    });
+    Benchmark::run("cache load albums", [&]() {
+        albumsData = cache.loadAlbumsData();
+        return static_cast<int>(albumsData.size());
+    });
+    Benchmark::run("cache load tracks", [&]() {
+        tracksData = cache.loadTracksData();
+        return static_cast<int>(tracksData.size());
+    });
+}
+
+}
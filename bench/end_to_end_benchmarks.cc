@@ -0,0 +1,152 @@
+// end_to_end_benchmarks.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <stdio.h>
+#include <string>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <functional>
+
+#include <QAbstractItemModel>
+#include <QAbstractItemView>
+#include <QEventLoop>
+#include <QListView>
+#include <QModelIndex>
+#include <QStatusBar>
+#include <QString>
+#include <QTimer>
+#include <QTreeView>
+
+#include "ampache_browser/settings.h"
+#include "application/settings_internal.h"
+#include "application/ampache_browser_app.h"
+#include "src/ui/ampache_browser_main_window.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "fake_ampache_server.h"
+#include "benchmarks.h"
+
+using namespace std::placeholders;
+using namespace ampache_browser;
+using namespace application;
+using namespace ui;
+
+
+
+namespace bench {
+
+// loading which takes longer (in milliseconds) is considered as failed
+static const int TIMEOUT = 30 * 60 * 1000;
+
+
+
+// runs the application until it is fully loaded and reports times of the first rows and of the full load
+static void benchmarkRun(const std::string& name, const SyntheticLibrary& library, FakeAmpacheServer& server) {
+    std::map<std::string, double> firstRowSeconds;
+    double fullyLoadedSeconds = -1;
+    QString loadingResult;
+    QEventLoop eventLoop;
+
+    SettingsInternal settingsInternal;
+    settingsInternal.setBool(Settings::USE_DEMO_SERVER, false);
+    settingsInternal.setString(Settings::SERVER_URL, "http://bench.invalid");
+    settingsInternal.setString(Settings::USER_NAME, "bench");
+    settingsInternal.setString(Settings::PASSWORD_HASH, "bench");
+    std::unique_ptr<AmpacheBrowserApp> ampacheBrowserApp{new AmpacheBrowserApp{settingsInternal}};
+    ampacheBrowserApp->setNetworkRequestFunction(bind(&FakeAmpacheServer::processRequest, &server, _1, _2));
+
+    auto begin = std::chrono::steady_clock::now();
+    auto elapsedSeconds = [&begin]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    };
+
+    ampacheBrowserApp->run();
+
+    // models insert rows as the data size becomes known or the data are loaded and notify about rows loaded later by
+    // dataChanged signal; rows which are not loaded yet are shown as "..."
+    auto mainWindow = static_cast<AmpacheBrowserMainWindow*>(ampacheBrowserApp->getMainWidget());
+    auto connectFirstRow = [&](const std::string& viewName, QAbstractItemView* view) {
+        auto model = view->model();
+        auto checkFirstRow = [&, viewName, model](int row) {
+            if (firstRowSeconds.count(viewName) == 0 && model->index(row, 0).data().toString() != "...") {
+                firstRowSeconds[viewName] = elapsedSeconds();
+            }
+        };
+        QObject::connect(model, &QAbstractItemModel::rowsInserted, &eventLoop,
+            [checkFirstRow](const QModelIndex&, int first, int) {
+                checkFirstRow(first);
+            });
+        QObject::connect(model, &QAbstractItemModel::dataChanged, &eventLoop,
+            [checkFirstRow](const QModelIndex& topLeft, const QModelIndex& bottomRight) {
+                if (bottomRight.row() >= topLeft.row()) {
+                    checkFirstRow(topLeft.row());
+                }
+            });
+    };
+    connectFirstRow("artist", mainWindow->artistsListView);
+    connectFirstRow("album", mainWindow->albumsListView);
+    connectFirstRow("track", mainWindow->tracksTreeView);
+
+    // the application notifies about the end of loading in the status bar
+    QObject::connect(mainWindow->statusBar(), &QStatusBar::messageChanged, &eventLoop, [&](const QString& message) {
+        if (!message.isEmpty() && message != "Loading...") {
+            fullyLoadedSeconds = elapsedSeconds();
+            loadingResult = message;
+            eventLoop.quit();
+        }
+    });
+    QTimer::singleShot(TIMEOUT, &eventLoop, [&eventLoop]() {
+        eventLoop.quit();
+    });
+
+    mainWindow->show();
+    eventLoop.exec();
+
+    for (auto& viewName: {"artist", "album", "track"}) {
+        if (firstRowSeconds.count(viewName) != 0) {
+            Benchmark::report(name + " first " + viewName + " row", 1, firstRowSeconds[viewName]);
+        }
+    }
+    if (fullyLoadedSeconds < 0) {
+        printf("%s: not loaded within %d s\n", name.c_str(), TIMEOUT / 1000);
+    } else {
+        Benchmark::report(name + " fully loaded",
+            library.numberOfArtists() + library.numberOfAlbums() + library.numberOfTracks(), fullyLoadedSeconds);
+        if (loadingResult != "Loaded.") {
+            printf("%s: %s\n", name.c_str(), loadingResult.toStdString().c_str());
+        }
+    }
+
+    bool isFinished = false;
+    ampacheBrowserApp->finishRequest([&]() {
+        isFinished = true;
+        eventLoop.quit();
+    });
+    if (!isFinished) {
+        eventLoop.exec();
+    }
+
+    // responses delayed by the latency would be delivered to the destroyed application
+    server.dropPendingResponses();
+}
+
+
+
+void runEndToEndBenchmarks(const SyntheticLibrary& library, int latency, int bandwidth) {
+    FakeAmpacheServer server{library, latency, bandwidth};
+
+    // the first run fills the cache which is used by the second one
+    benchmarkRun("end-to-end cold cache", library, server);
+    benchmarkRun("end-to-end warm cache", library, server);
+    printf("%-40s %10d requests, %.1f MiB sent\n", "end-to-end server", server.numberOfRequests(),
+        server.numberOfSentBytes() / 1024.0 / 1024.0);
+}
+
+}
@@ -0,0 +1,122 @@
+// fake_ampache_server.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <string>
+#include <memory>
+
+#include <QByteArray>
+#include <QBuffer>
+#include <QColor>
+#include <QImage>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QUrl>
+#include <QUrlQuery>
+
+#include "data/providers/ampache/ampache.h"
+#include "synthetic_library.h"
+#include "fake_ampache_server.h"
+
+using namespace data;
+
+
+
+namespace bench {
+
+FakeAmpacheServer::FakeAmpacheServer(const SyntheticLibrary& library, int latency, int bandwidth):
+myLibrary{library},
+myLatency{latency},
+myBandwidth{bandwidth},
+myAlbumArt{createAlbumArt()},
+myPendingResponses{new QObject{}} {
+}
+
+
+
+void FakeAmpacheServer::processRequest(const std::string& url, Ampache::NetworkRequestCb& networkRequestCb) {
+    auto content = createResponse(url);
+    myNumberOfRequests++;
+    myNumberOfSentBytes += content.size();
+
+    int delay = myLatency;
+    if (myBandwidth > 0) {
+        delay += static_cast<int>(static_cast<long long>(content.size()) * 1000 / myBandwidth);
+    }
+    QTimer::singleShot(delay, myPendingResponses.get(), [url, content, &networkRequestCb]() {
+        networkRequestCb(url, content.data(), static_cast<int>(content.size()));
+    });
+}
+
+
+
+void FakeAmpacheServer::dropPendingResponses() {
+    myPendingResponses.reset(new QObject{});
+}
+
+
+
+int FakeAmpacheServer::numberOfRequests() const {
+    return myNumberOfRequests;
+}
+
+
+
+long long FakeAmpacheServer::numberOfSentBytes() const {
+    return myNumberOfSentBytes;
+}
+
+
+
+std::string FakeAmpacheServer::createResponse(const std::string& url) const {
+    QUrl qUrl{QString::fromStdString(url)};
+    if (qUrl.path().endsWith("/art")) {
+        return myAlbumArt;
+    }
+
+    QUrlQuery query{qUrl};
+    auto action = query.queryItemValue("action");
+    if (action == "handshake") {
+        return myLibrary.createHandshakeXml();
+    } else if (action == "ping") {
+        return "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<root>\n"
+            "<session_expire><![CDATA[2099-01-01T00:00:00+00:00]]></session_expire>\n</root>\n";
+    }
+
+    // the library never changes
+    if (query.hasQueryItem("add") || query.hasQueryItem("update")) {
+        return "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<root>\n</root>\n";
+    }
+
+    int offset = query.queryItemValue("offset").toInt();
+    int limit = query.queryItemValue("limit").toInt();
+    if (action == "artists") {
+        return myLibrary.createArtistsXml(offset, limit);
+    } else if (action == "albums") {
+        return myLibrary.createAlbumsXml(offset, limit);
+    } else if (action == "songs") {
+        return myLibrary.createTracksXml(offset, limit);
+    }
+    return "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<root>\n"
+        "<error code=\"405\"><![CDATA[Invalid Request]]></error>\n</root>\n";
+}
+
+
+
+std::string FakeAmpacheServer::createAlbumArt() const {
+    QImage image{300, 300, QImage::Format_RGB32};
+    image.fill(QColor{70, 110, 150});
+    QByteArray imageData;
+    QBuffer buffer{&imageData};
+    buffer.open(QBuffer::WriteOnly);
+    image.save(&buffer, "PNG");
+    return std::string{imageData.constData(), static_cast<size_t>(imageData.size())};
+}
+
+}
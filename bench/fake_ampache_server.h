@@ -0,0 +1,103 @@
+// fake_ampache_server.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef FAKEAMPACHESERVER_H
+#define FAKEAMPACHESERVER_H
+
+
+
+#include <string>
+#include <memory>
+
+#include <QObject>
+
+#include "data/providers/ampache/ampache.h"
+
+
+
+namespace bench {
+
+class SyntheticLibrary;
+
+
+
+/**
+ * @brief In-process stand-in for Ampache server which serves a synthetic library.
+ *
+ * Requests are passed to processRequest() which has the signature of data::Ampache::NetworkRequestFn so that the
+ * instance can be injected instead of the real network.  Responds to handshake, ping, artists, albums and songs
+ * methods and to album art requests.  Requests for records changed since a time point are responded with no records.
+ *
+ * Each response is delayed by the latency and by the time its transfer takes with the given bandwidth.  Requests are
+ * processed independently as if each used its own connection.  Responses which are still delayed can be dropped by
+ * dropPendingResponses(), e. g. before the instance which made the requests is destroyed.
+ */
+class FakeAmpacheServer {
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param library The library that shall be served.
+     * @param latency Delay of each response in milliseconds.
+     * @param bandwidth Transfer rate of a response in bytes per second.  0 if unlimited.
+     */
+    explicit FakeAmpacheServer(const SyntheticLibrary& library, int latency = 0, int bandwidth = 0);
+
+    FakeAmpacheServer(const FakeAmpacheServer& other) = delete;
+
+    FakeAmpacheServer& operator=(const FakeAmpacheServer& other) = delete;
+
+    /**
+     * @brief Processes a network request and responds to it asynchronously.
+     *
+     * @param url The requested URL.
+     * @param networkRequestCb Callback which is called with the response.
+     */
+    void processRequest(const std::string& url, data::Ampache::NetworkRequestCb& networkRequestCb);
+
+    /**
+     * @brief Drops the responses which were not delivered yet; their callbacks are not called.
+     */
+    void dropPendingResponses();
+
+    /**
+     * @brief Gets the number of processed requests.
+     */
+    int numberOfRequests() const;
+
+    /**
+     * @brief Gets the number of bytes sent in responses.
+     */
+    long long numberOfSentBytes() const;
+
+private:
+    // arguments from the constructor
+    const SyntheticLibrary& myLibrary;
+    const int myLatency;
+    const int myBandwidth;
+
+    // album art image; the same for all albums
+    const std::string myAlbumArt;
+
+    // context of the timers of delayed responses; deleting it stops them
+    std::unique_ptr<QObject> myPendingResponses;
+
+    int myNumberOfRequests = 0;
+    long long myNumberOfSentBytes = 0;
+
+    std::string createResponse(const std::string& url) const;
+    std::string createAlbumArt() const;
+};
+
+}
+
+
+
+#endif // FAKEAMPACHESERVER_H
@@ -0,0 +1,231 @@
+// filter_benchmarks.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <cctype>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include "infrastructure/case_insensitive_search.h"
+#include "domain/artist.h"
+#include "domain/album.h"
+#include "src/data/data_objects/artist_data.h"
+#include "src/data/data_objects/album_data.h"
+#include "src/data/data_objects/track_data.h"
+#include "data/indices.h"
+#include "data/name_index.h"
+#include "data/filters/filter.h"
+#include "data/filters/unfiltered_filter.h"
+#include "data/filters/name_filter_for_artists.h"
+#include "data/filters/name_filter_for_albums.h"
+#include "data/filters/name_filter_for_tracks.h"
+#include "data/filters/artist_filter_for_albums.h"
+#include "data/filters/artist_filter_for_tracks.h"
+#include "data/filters/album_filter_for_tracks.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "benchmarks.h"
+
+using namespace infrastructure;
+using namespace domain;
+using namespace data;
+
+
+
+namespace bench {
+
+// pattern of name filters; matches a small fraction of names
+static const std::string NAME_PATTERN = "night";
+
+// pattern of name filters which is too short to be searched in the name index
+static const std::string SHORT_NAME_PATTERN = "ni";
+
+// number of data items updated at once when filters process data being loaded
+static const int UPDATE_SIZE = 60;
+
+
+
+// benchmarks building of a name index as repositories do it while loading
+template <typename T>
+static void benchmarkNameIndex(const std::string& name, NameIndex& nameIndex,
+    const std::vector<std::unique_ptr<T>>& sourceData, const std::function<std::string(const T&)>& getName) {
+
+    Benchmark::run(name, [&]() {
+        for (int idx = 0; idx < static_cast<int>(sourceData.size()); idx++) {
+            nameIndex.add(idx, getName(*sourceData[idx]));
+        }
+        return static_cast<int>(sourceData.size());
+    });
+}
+
+
+
+// benchmarks a filter which processes all source data; reports the number of processed source data items
+template <typename T>
+static void benchmarkSourceFilter(const std::string& name, const std::function<Filter<T>*()>& createFilter,
+    const std::vector<std::unique_ptr<T>>& sourceData) {
+
+    std::unique_ptr<Filter<T>> filter;
+    Benchmark::run(name, [&]() {
+        filter.reset(createFilter());
+        filter->setSourceData(sourceData);
+        return static_cast<int>(sourceData.size());
+    });
+}
+
+
+
+// benchmarks a filter which uses indices; reports the number of data items in the result
+template <typename T>
+static void benchmarkIndexFilter(const std::string& name, const std::function<Filter<T>*()>& createFilter,
+    const std::vector<std::unique_ptr<T>>& sourceData) {
+
+    std::unique_ptr<Filter<T>> filter;
+    Benchmark::run(name, [&]() {
+        filter.reset(createFilter());
+        filter->setSourceData(sourceData);
+        return static_cast<int>(filter->getFilteredData().size());
+    });
+}
+
+
+
+void runFilterBenchmarks(const SyntheticLibrary& library) {
+    auto artistsData = library.createArtistsData();
+    auto albumsData = library.createAlbumsData();
+    auto tracksData = library.createTracksData();
+    library.link(artistsData, albumsData, tracksData);
+
+    std::vector<std::reference_wrapper<Artist>> mutableArtists;
+    std::vector<std::reference_wrapper<const Artist>> artists;
+    for (auto& artistData: artistsData) {
+        mutableArtists.push_back(artistData->getArtist());
+        artists.push_back(artistData->getArtist());
+    }
+    std::vector<std::reference_wrapper<Album>> mutableAlbums;
+    std::vector<std::reference_wrapper<const Album>> albums;
+    for (auto& albumData: albumsData) {
+        mutableAlbums.push_back(albumData->getAlbum());
+        albums.push_back(albumData->getAlbum());
+    }
+
+    Indices indices{library.getArtistIds(), library.getAlbumIds()};
+    indices.addArtists(mutableArtists);
+    indices.addAlbums(mutableAlbums);
+    indices.updateArtistAlbums(library.createArtistAlbumsIndex(albumsData));
+    indices.updateArtistTracks(library.createArtistTracksIndex(tracksData));
+    indices.updateAlbumTracks(library.createAlbumTracksIndex(tracksData));
+
+    // matching of names alone; the former implementation is compared with the current one which matches the folded
+    // names of the name index
+    NameIndex trackNamesIndex;
+    std::vector<std::string> trackNames;
+    for (unsigned int idx = 0; idx < tracksData.size(); idx++) {
+        trackNames.push_back(tracksData[idx]->getTrack().getName());
+        trackNamesIndex.add(idx, trackNames.back());
+    }
+    // matches are counted so that the matching is not optimized away
+    int numberOfMatchingNames = 0;
+    Benchmark::run("match track names std::search", [&]() {
+        numberOfMatchingNames = 0;
+        for (auto& trackName: trackNames) {
+            if (std::search(trackName.begin(), trackName.end(), NAME_PATTERN.begin(), NAME_PATTERN.end(),
+                [](char c1, char c2) {return toupper(c1) == toupper(c2); }) != trackName.end()) {
+                numberOfMatchingNames++;
+            }
+        }
+        return static_cast<int>(trackNames.size());
+    });
+    Benchmark::run("match track names folded", [&]() {
+        CaseInsensitiveSearch search{trackNamesIndex.fold(NAME_PATTERN)};
+        numberOfMatchingNames = 0;
+        for (unsigned int idx = 0; idx < trackNames.size(); idx++) {
+            if (search.isFoundIn(trackNamesIndex.getFoldedName(idx))) {
+                numberOfMatchingNames++;
+            }
+        }
+        return static_cast<int>(trackNames.size());
+    });
+    Benchmark::run("fold track names", [&]() {
+        for (auto& trackName: trackNames) {
+            numberOfMatchingNames += trackNamesIndex.fold(trackName).size();
+        }
+        return static_cast<int>(trackNames.size());
+    });
+
+    NameIndex artistsNameIndex;
+    NameIndex albumsNameIndex;
+    NameIndex tracksNameIndex;
+    benchmarkNameIndex<ArtistData>("name index add artists", artistsNameIndex, artistsData,
+        [](const ArtistData& artistData) {return artistData.getArtist().getName(); });
+    benchmarkNameIndex<AlbumData>("name index add albums", albumsNameIndex, albumsData,
+        [](const AlbumData& albumData) {return albumData.getAlbum().getName(); });
+    benchmarkNameIndex<TrackData>("name index add tracks", tracksNameIndex, tracksData,
+        [](const TrackData& trackData) {return trackData.getTrack().getName(); });
+
+    benchmarkSourceFilter<TrackData>("filter unfiltered tracks", []() {
+        return new UnfilteredFilter<TrackData>{};
+    }, tracksData);
+    benchmarkSourceFilter<ArtistData>("filter name artists", [&]() {
+        return new NameFilterForArtists{NAME_PATTERN, artistsNameIndex};
+    }, artistsData);
+    benchmarkSourceFilter<AlbumData>("filter name albums", [&]() {
+        return new NameFilterForAlbums{NAME_PATTERN, albumsNameIndex};
+    }, albumsData);
+    benchmarkSourceFilter<TrackData>("filter name tracks", [&]() {
+        return new NameFilterForTracks{NAME_PATTERN, tracksNameIndex};
+    }, tracksData);
+    benchmarkSourceFilter<TrackData>("filter name tracks short pattern", [&]() {
+        return new NameFilterForTracks{SHORT_NAME_PATTERN, tracksNameIndex};
+    }, tracksData);
+
+    // the search text is being typed; the previous filter was set for the pattern without its last character
+    NameFilterForTracks previousTracksFilter{NAME_PATTERN.substr(0, NAME_PATTERN.size() - 1), tracksNameIndex};
+    previousTracksFilter.setSourceData(tracksData);
+    benchmarkSourceFilter<TrackData>("filter name tracks refined", [&]() {
+        return new NameFilterForTracks{NAME_PATTERN, tracksNameIndex, &previousTracksFilter};
+    }, tracksData);
+
+    // views are notified only about the tracks which were removed by the refined search
+    NameFilterForTracks refinedTracksFilter{NAME_PATTERN, tracksNameIndex, &previousTracksFilter};
+    refinedTracksFilter.setSourceData(tracksData);
+    FilteredDataSnapshot<TrackData> previousTracksSnapshot;
+    previousTracksFilter.takeSnapshot(previousTracksSnapshot);
+    std::vector<FilteredDataChange> changes;
+    Benchmark::run("changes of filtered tracks refined", [&]() {
+        refinedTracksFilter.getChangesSince(previousTracksSnapshot, changes);
+        return static_cast<int>(previousTracksFilter.getFilteredData().size());
+    });
+
+    // an active search while the data are being loaded
+    NameFilterForTracks updatedTracksFilter{NAME_PATTERN, tracksNameIndex};
+    updatedTracksFilter.setSourceData(tracksData);
+    Benchmark::run("filter name tracks updates", [&]() {
+        int numberOfTracks = tracksData.size();
+        for (int offset = 0; offset < numberOfTracks; offset += UPDATE_SIZE) {
+            updatedTracksFilter.processUpdatedSourceData(offset, std::min(UPDATE_SIZE, numberOfTracks - offset));
+        }
+        return numberOfTracks;
+    });
+
+    // all artists and albums are selected which is the worst case
+    benchmarkIndexFilter<AlbumData>("filter artist albums", [&]() {
+        return new ArtistFilterForAlbums{artists, indices};
+    }, albumsData);
+    benchmarkIndexFilter<TrackData>("filter artist tracks", [&]() {
+        return new ArtistFilterForTracks{artists, indices};
+    }, tracksData);
+    benchmarkIndexFilter<TrackData>("filter album tracks", [&]() {
+        return new AlbumFilterForTracks{albums, indices};
+    }, tracksData);
+}
+
+}
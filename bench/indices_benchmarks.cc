@@ -0,0 +1,72 @@
+// indices_benchmarks.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include "domain/artist.h"
+#include "domain/album.h"
+#include "src/data/data_objects/artist_data.h"
+#include "src/data/data_objects/album_data.h"
+#include "src/data/data_objects/track_data.h"
+#include "data/indices.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "benchmarks.h"
+
+using namespace domain;
+using namespace data;
+
+
+
+namespace bench {
+
+void runIndicesBenchmarks(const SyntheticLibrary& library) {
+    auto artistsData = library.createArtistsData();
+    auto albumsData = library.createAlbumsData();
+    auto tracksData = library.createTracksData();
+    library.link(artistsData, albumsData, tracksData);
+
+    std::vector<std::reference_wrapper<Artist>> artists;
+    for (auto& artistData: artistsData) {
+        artists.push_back(artistData->getArtist());
+    }
+    std::vector<std::reference_wrapper<Album>> albums;
+    for (auto& albumData: albumsData) {
+        albums.push_back(albumData->getAlbum());
+    }
+    auto artistAlbums = library.createArtistAlbumsIndex(albumsData);
+    auto artistTracks = library.createArtistTracksIndex(tracksData);
+    auto albumTracks = library.createAlbumTracksIndex(tracksData);
+
+    Indices indices{library.getArtistIds(), library.getAlbumIds()};
+    Benchmark::run("indices add artists", [&]() {
+        indices.addArtists(artists);
+        return static_cast<int>(artists.size());
+    });
+    Benchmark::run("indices add albums", [&]() {
+        indices.addAlbums(albums);
+        return static_cast<int>(albums.size());
+    });
+    Benchmark::run("indices update artist albums", [&]() {
+        indices.updateArtistAlbums(artistAlbums);
+        return static_cast<int>(albumsData.size());
+    });
+    Benchmark::run("indices update artist tracks", [&]() {
+        indices.updateArtistTracks(artistTracks);
+        return static_cast<int>(tracksData.size());
+    });
+    Benchmark::run("indices update album tracks", [&]() {
+        indices.updateAlbumTracks(albumTracks);
+        return static_cast<int>(tracksData.size());
+    });
+}
+
+}
@@ -0,0 +1,146 @@
+// repository_benchmarks.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+
+#include "infrastructure/event/event.h"
+#include "src/data/data_objects/artist_data.h"
+#include "src/data/data_objects/album_data.h"
+#include "src/data/data_objects/track_data.h"
+#include "data/provider_type.h"
+#include "data/providers/ampache/ampache.h"
+#include "data/providers/cache.h"
+#include "data/indices.h"
+#include "data/repositories/repository.h"
+#include "data/repositories/artist_repository.h"
+#include "data/repositories/album_repository.h"
+#include "data/repositories/track_repository.h"
+#include "data/filters/name_filter_for_tracks.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "ampache_fixture.h"
+#include "benchmarks.h"
+
+using namespace infrastructure;
+using namespace data;
+
+
+
+namespace bench {
+
+// number of records loaded by a single load; the same as the granularity of requests of models
+static const int PAGE_SIZE = 60;
+
+// pattern of the name filter in the paint benchmark; matches most of the names
+static const std::string PAINT_NAME_PATTERN = "e";
+
+
+
+template <typename T>
+static std::vector<std::vector<std::unique_ptr<T>>> splitToPages(std::vector<std::unique_ptr<T>> data) {
+    std::vector<std::vector<std::unique_ptr<T>>> pages;
+    for (size_t offset = 0; offset < data.size(); offset += PAGE_SIZE) {
+        auto end = std::min(offset + PAGE_SIZE, data.size());
+        pages.emplace_back(std::make_move_iterator(data.begin() + offset), std::make_move_iterator(data.begin() + end));
+    }
+    return pages;
+}
+
+
+
+// loads the given pages to the repository as if they were returned by the server
+template <typename T, typename U>
+static int loadPages(Repository<T, U>& repository, Event<ReadyData<T>>& readyEvent,
+    std::vector<std::vector<std::unique_ptr<T>>>& pages, int offset) {
+
+    int numberOfLoaded = 0;
+    for (auto& page: pages) {
+        int limit = static_cast<int>(page.size());
+        repository.load(offset, limit);
+        ReadyData<T> readyData{offset, std::move(page), false};
+        readyEvent(readyData);
+        offset += limit;
+        numberOfLoaded += limit;
+    }
+    return numberOfLoaded;
+}
+
+
+
+// loads all but the last page in the benchmark; the last one is loaded separately since fully loaded repository
+// saves its data to the cache which is benchmarked elsewhere
+template <typename T, typename U>
+static void benchmarkLoad(const std::string& name, Repository<T, U>& repository, Event<ReadyData<T>>& readyEvent,
+    std::vector<std::unique_ptr<T>> data) {
+
+    auto pages = splitToPages(std::move(data));
+    std::vector<std::vector<std::unique_ptr<T>>> lastPages;
+    lastPages.push_back(std::move(pages.back()));
+    pages.pop_back();
+
+    int numberOfLoaded = 0;
+    Benchmark::run(name, [&]() {
+        numberOfLoaded = loadPages(repository, readyEvent, pages, 0);
+        return numberOfLoaded;
+    });
+    loadPages(repository, readyEvent, lastPages, numberOfLoaded);
+}
+
+
+
+// queries all rows the same way as models do when views paint them; reports the number of painted rows
+template <typename T, typename U>
+static void benchmarkPaint(const std::string& name, Repository<T, U>& repository) {
+    int numberOfNameCharacters = 0;
+    Benchmark::run(name, [&]() {
+        int count = repository.count();
+        for (int row = 0; row < count; row++) {
+            if (repository.isLoaded(row)) {
+                numberOfNameCharacters += repository.get(row).getName().size();
+            }
+        }
+        return count;
+    });
+}
+
+
+
+void runRepositoryBenchmarks(const SyntheticLibrary& library) {
+
+    // the server does not respond to data requests; they are answered by the benchmark itself
+    AmpacheFixture ampacheFixture{library, [](const std::string&, int) {
+        return std::string{};
+    }};
+    ampacheFixture.initialize();
+    auto& ampache = ampacheFixture.getAmpache();
+
+    Cache cache{"http://bench.invalid", "bench", library.getArtistIds(), library.getAlbumIds()};
+    Indices indices{library.getArtistIds(), library.getAlbumIds()};
+    ArtistRepository artistRepository{ampache, cache, indices, library.getArtistIds()};
+    AlbumRepository albumRepository{ampache, cache, indices, library.getAlbumIds(), &artistRepository};
+    TrackRepository trackRepository{ampache, cache, indices, &artistRepository, &albumRepository};
+    artistRepository.setProviderType(ProviderType::Ampache);
+    albumRepository.setProviderType(ProviderType::Ampache);
+    trackRepository.setProviderType(ProviderType::Ampache);
+
+    benchmarkLoad("repository load artists", artistRepository, ampache.readyArtists, library.createArtistsData());
+    benchmarkLoad("repository load albums", albumRepository, ampache.readyAlbums, library.createAlbumsData());
+    benchmarkLoad("repository load tracks", trackRepository, ampache.readyTracks, library.createTracksData());
+
+    benchmarkPaint("repository paint tracks", trackRepository);
+    trackRepository.setFilter(std::unique_ptr<Filter<TrackData>>{
+        new NameFilterForTracks{PAINT_NAME_PATTERN, trackRepository.getNameIndex()}});
+    benchmarkPaint("repository paint tracks filtered", trackRepository);
+    trackRepository.unsetFilter();
+}
+
+}
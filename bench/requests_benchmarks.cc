@@ -0,0 +1,119 @@
+// requests_benchmarks.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <algorithm>
+#include <vector>
+#include <random>
+
+#include "infrastructure/event/delegate.h"
+#include "src/application/models/request_group.h"
+#include "src/application/models/requests.h"
+#include "benchmark.h"
+#include "synthetic_library.h"
+#include "benchmarks.h"
+
+using namespace infrastructure;
+using namespace application;
+
+
+
+namespace bench {
+
+// the same values as models use
+static const int GRANULARITY = 60;
+static const int WINDOW = 4;
+
+
+
+// adds the given requests and finishes each ready group right after the request that made it ready was added
+static int addAndFinishImmediately(const std::vector<int>& offsets) {
+    Requests requests{GRANULARITY, WINDOW};
+    std::vector<RequestGroup> readyGroups;
+    requests.readyToExecute += Delegate<RequestGroup>{"addAndFinishImmediately", &requests,
+        [&readyGroups](RequestGroup& requestGroup) {
+            readyGroups.push_back(requestGroup);
+        }};
+
+    for (auto offset: offsets) {
+        requests.add(offset);
+        while (!readyGroups.empty()) {
+            auto requestGroup = readyGroups.front();
+            readyGroups.erase(readyGroups.begin());
+            requests.setFinished(requestGroup.getLower(), requestGroup.getSize());
+        }
+    }
+    return static_cast<int>(offsets.size());
+}
+
+
+
+// adds all the given requests first and then finishes ready groups until there is nothing in progress
+static int addAllAndFinish(const std::vector<int>& offsets) {
+    Requests requests{GRANULARITY, WINDOW};
+    std::vector<RequestGroup> readyGroups;
+    requests.readyToExecute += Delegate<RequestGroup>{"addAllAndFinish", &requests,
+        [&readyGroups](RequestGroup& requestGroup) {
+            readyGroups.push_back(requestGroup);
+        }};
+
+    for (auto offset: offsets) {
+        requests.add(offset);
+    }
+    while (!readyGroups.empty()) {
+        auto requestGroup = readyGroups.front();
+        readyGroups.erase(readyGroups.begin());
+        requests.setFinished(requestGroup.getLower(), requestGroup.getSize());
+    }
+    return static_cast<int>(offsets.size());
+}
+
+
+
+// adds all requests from 0 to the given count at once and then finishes ready groups until there is nothing in progress
+static int addRangeAndFinish(int count) {
+    Requests requests{GRANULARITY, WINDOW};
+    std::vector<RequestGroup> readyGroups;
+    requests.readyToExecute += Delegate<RequestGroup>{"addRangeAndFinish", &requests,
+        [&readyGroups](RequestGroup& requestGroup) {
+            readyGroups.push_back(requestGroup);
+        }};
+
+    requests.add(0, count);
+    for (size_t idx = 0; idx < readyGroups.size(); idx++) {
+        requests.setFinished(readyGroups[idx].getLower(), readyGroups[idx].getSize());
+    }
+    return count;
+}
+
+
+
+void runRequestsBenchmarks(const SyntheticLibrary& library) {
+    std::vector<int> offsets(library.numberOfTracks());
+    for (int offset = 0; offset < static_cast<int>(offsets.size()); offset++) {
+        offsets[offset] = offset;
+    }
+
+    // scrolling through a view row by row
+    Benchmark::run("requests sequential", [&]() {
+        return addAndFinishImmediately(offsets);
+    });
+
+    // jumping in a view while the server is busy
+    std::shuffle(offsets.begin(), offsets.end(), std::mt19937{1});
+    Benchmark::run("requests random while busy", [&]() {
+        return addAllAndFinish(offsets);
+    });
+
+    // requesting all data after a change of the provider
+    Benchmark::run("requests all data", [&]() {
+        return addRangeAndFinish(library.numberOfTracks());
+    });
+}
+
+}
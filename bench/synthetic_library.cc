@@ -0,0 +1,290 @@
+// synthetic_library.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "domain/artist.h"
+#include "domain/album.h"
+#include "domain/track.h"
+#include "data/id_interner.h"
+#include "src/data/data_objects/artist_data.h"
+#include "src/data/data_objects/album_data.h"
+#include "src/data/data_objects/track_data.h"
+#include "synthetic_library.h"
+
+using namespace domain;
+using namespace data;
+
+
+
+namespace bench {
+
+// words the names are composed of
+static const std::vector<std::string> WORDS{"Blue", "Night", "River", "Stone", "Dream", "Fire", "Silent", "Golden",
+    "Electric", "Winter", "Ocean", "Shadow", "Velvet", "Crystal", "Thunder", "Paper", "Neon", "Wild", "Broken",
+    "Midnight", "Summer", "Iron", "Glass", "Distant", "Hollow", "Lunar", "Scarlet", "Echo", "Garden", "Storm",
+    "Čierny", "Ängel"};
+
+
+
+SyntheticLibrary::SyntheticLibrary(int numberOfTracks):
+myNumberOfTracks{numberOfTracks},
+myNumberOfAlbums{std::max(1, numberOfTracks / 10)},
+myNumberOfArtists{std::max(1, numberOfTracks / 100)},
+myArtistIds{new IdInterner{{AlbumData::NO_ARTIST_ID}}},
+myAlbumIds{new IdInterner{}} {
+}
+
+
+
+SyntheticLibrary::~SyntheticLibrary() = default;
+
+
+
+int SyntheticLibrary::numberOfArtists() const {
+    return myNumberOfArtists;
+}
+
+
+
+int SyntheticLibrary::numberOfAlbums() const {
+    return myNumberOfAlbums;
+}
+
+
+
+int SyntheticLibrary::numberOfTracks() const {
+    return myNumberOfTracks;
+}
+
+
+
+IdInterner& SyntheticLibrary::getArtistIds() const {
+    return *myArtistIds;
+}
+
+
+
+IdInterner& SyntheticLibrary::getAlbumIds() const {
+    return *myAlbumIds;
+}
+
+
+
+std::vector<std::unique_ptr<ArtistData>> SyntheticLibrary::createArtistsData() const {
+    std::vector<std::unique_ptr<ArtistData>> artistsData;
+    artistsData.reserve(myNumberOfArtists);
+    for (int idx = 0; idx < myNumberOfArtists; idx++) {
+        auto id = std::to_string(idx + 1);
+        artistsData.emplace_back(new ArtistData{id, 10, 100,
+            std::unique_ptr<Artist>{new Artist{id, createName(idx)}}});
+    }
+    return artistsData;
+}
+
+
+
+std::vector<std::unique_ptr<AlbumData>> SyntheticLibrary::createAlbumsData() const {
+    std::vector<std::unique_ptr<AlbumData>> albumsData;
+    albumsData.reserve(myNumberOfAlbums);
+    for (int idx = 0; idx < myNumberOfAlbums; idx++) {
+        auto id = std::to_string(idx + 1);
+        albumsData.emplace_back(new AlbumData{id, "http://bench.invalid/art?id=" + id,
+            myArtistIds->intern(std::to_string(getArtistOfAlbum(idx) + 1)), 10,
+            std::unique_ptr<Album>{new Album{id, createName(idx + 7), 1970 + idx % 50, 1}}});
+    }
+    return albumsData;
+}
+
+
+
+std::vector<std::unique_ptr<TrackData>> SyntheticLibrary::createTracksData() const {
+    std::vector<std::unique_ptr<TrackData>> tracksData;
+    tracksData.reserve(myNumberOfTracks);
+    for (int idx = 0; idx < myNumberOfTracks; idx++) {
+        auto id = std::to_string(idx + 1);
+        auto albumIdx = getAlbumOfTrack(idx);
+        tracksData.emplace_back(new TrackData{id, myArtistIds->intern(std::to_string(getArtistOfAlbum(albumIdx) + 1)),
+            myAlbumIds->intern(std::to_string(albumIdx + 1)), createName(idx + 13), "1", idx % 10 + 1,
+            "http://bench.invalid/play?id=" + id});
+    }
+    return tracksData;
+}
+
+
+
+void SyntheticLibrary::link(const std::vector<std::unique_ptr<ArtistData>>& artistsData,
+    const std::vector<std::unique_ptr<AlbumData>>& albumsData,
+    const std::vector<std::unique_ptr<TrackData>>& tracksData) const {
+
+    for (auto& albumData: albumsData) {
+        auto artistIdx = toIdx(myArtistIds->getId(albumData->getArtistIdHandle()));
+        albumData->getAlbum().setArtist(artistsData[artistIdx]->getArtist());
+    }
+    for (auto& trackData: tracksData) {
+        auto artistIdx = toIdx(myArtistIds->getId(trackData->getArtistIdHandle()));
+        auto albumIdx = toIdx(myAlbumIds->getId(trackData->getAlbumIdHandle()));
+        trackData->getTrack().setArtist(artistsData[artistIdx]->getArtist());
+        trackData->getTrack().setAlbum(albumsData[albumIdx]->getAlbum());
+    }
+}
+
+
+
+ArtistAlbumsIndex SyntheticLibrary::createArtistAlbumsIndex(
+    const std::vector<std::unique_ptr<AlbumData>>& albumsData) const {
+
+    ArtistAlbumsIndex artistAlbums;
+    for (auto& albumData: albumsData) {
+        artistAlbums.emplace_back(albumData->getArtistIdHandle(), albumData.get());
+    }
+    return artistAlbums;
+}
+
+
+
+ArtistTracksIndex SyntheticLibrary::createArtistTracksIndex(
+    const std::vector<std::unique_ptr<TrackData>>& tracksData) const {
+
+    ArtistTracksIndex artistTracks;
+    for (auto& trackData: tracksData) {
+        artistTracks.emplace_back(trackData->getArtistIdHandle(), trackData.get());
+    }
+    return artistTracks;
+}
+
+
+
+AlbumTracksIndex SyntheticLibrary::createAlbumTracksIndex(
+    const std::vector<std::unique_ptr<TrackData>>& tracksData) const {
+
+    AlbumTracksIndex albumTracks;
+    for (auto& trackData: tracksData) {
+        albumTracks.emplace_back(trackData->getAlbumIdHandle(), trackData.get());
+    }
+    return albumTracks;
+}
+
+
+
+std::string SyntheticLibrary::createHandshakeXml() const {
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<root>\n"
+        << "<auth><![CDATA[0123456789abcdef]]></auth>\n"
+        << "<api><![CDATA[440001]]></api>\n"
+        << "<update><![CDATA[2026-01-01T00:00:00+00:00]]></update>\n"
+        << "<add><![CDATA[2026-01-01T00:00:00+00:00]]></add>\n"
+        << "<clean><![CDATA[2026-01-01T00:00:00+00:00]]></clean>\n"
+        << "<songs><![CDATA[" << myNumberOfTracks << "]]></songs>\n"
+        << "<albums><![CDATA[" << myNumberOfAlbums << "]]></albums>\n"
+        << "<artists><![CDATA[" << myNumberOfArtists << "]]></artists>\n"
+        << "</root>\n";
+    return xml.str();
+}
+
+
+
+std::string SyntheticLibrary::createArtistsXml(int offset, int limit) const {
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<root>\n";
+    for (int idx = offset; idx < std::min(offset + limit, myNumberOfArtists); idx++) {
+        xml << "<artist id=\"" << idx + 1 << "\">\n"
+            << "  <name><![CDATA[" << createName(idx) << "]]></name>\n"
+            << "  <albums>10</albums>\n"
+            << "  <songs>100</songs>\n"
+            << "  <tag id=\"1\" count=\"1\"><![CDATA[Rock]]></tag>\n"
+            << "  <preciserating>0</preciserating>\n"
+            << "  <rating>0</rating>\n"
+            << "</artist>\n";
+    }
+    xml << "</root>\n";
+    return xml.str();
+}
+
+
+
+std::string SyntheticLibrary::createAlbumsXml(int offset, int limit) const {
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<root>\n";
+    for (int idx = offset; idx < std::min(offset + limit, myNumberOfAlbums); idx++) {
+        auto artistIdx = getArtistOfAlbum(idx);
+        xml << "<album id=\"" << idx + 1 << "\">\n"
+            << "  <name><![CDATA[" << createName(idx + 7) << "]]></name>\n"
+            << "  <artist id=\"" << artistIdx + 1 << "\"><![CDATA[" << createName(artistIdx) << "]]></artist>\n"
+            << "  <year>" << 1970 + idx % 50 << "</year>\n"
+            << "  <tracks>10</tracks>\n"
+            << "  <disk>1</disk>\n"
+            << "  <tag id=\"1\" count=\"1\"><![CDATA[Rock]]></tag>\n"
+            << "  <art><![CDATA[http://bench.invalid/art?id=" << idx + 1 << "]]></art>\n"
+            << "  <preciserating>0</preciserating>\n"
+            << "  <rating>0</rating>\n"
+            << "</album>\n";
+    }
+    xml << "</root>\n";
+    return xml.str();
+}
+
+
+
+std::string SyntheticLibrary::createTracksXml(int offset, int limit) const {
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<root>\n";
+    for (int idx = offset; idx < std::min(offset + limit, myNumberOfTracks); idx++) {
+        auto albumIdx = getAlbumOfTrack(idx);
+        auto artistIdx = getArtistOfAlbum(albumIdx);
+        xml << "<song id=\"" << idx + 1 << "\">\n"
+            << "  <title><![CDATA[" << createName(idx + 13) << "]]></title>\n"
+            << "  <artist id=\"" << artistIdx + 1 << "\"><![CDATA[" << createName(artistIdx) << "]]></artist>\n"
+            << "  <album id=\"" << albumIdx + 1 << "\"><![CDATA[" << createName(albumIdx + 7) << "]]></album>\n"
+            << "  <tag id=\"1\" count=\"1\"><![CDATA[Rock]]></tag>\n"
+            << "  <track>" << idx % 10 + 1 << "</track>\n"
+            << "  <disk>1</disk>\n"
+            << "  <time>245</time>\n"
+            << "  <url><![CDATA[http://bench.invalid/play?id=" << idx + 1 << "]]></url>\n"
+            << "  <size>4096000</size>\n"
+            << "  <mime><![CDATA[audio/mpeg]]></mime>\n"
+            << "  <preciserating>0</preciserating>\n"
+            << "  <rating>0</rating>\n"
+            << "</song>\n";
+    }
+    xml << "</root>\n";
+    return xml.str();
+}
+
+
+
+int SyntheticLibrary::toIdx(const std::string& id) const {
+    return std::stoi(id) - 1;
+}
+
+
+
+int SyntheticLibrary::getAlbumOfTrack(int trackIdx) const {
+    return std::min(trackIdx / 10, myNumberOfAlbums - 1);
+}
+
+
+
+int SyntheticLibrary::getArtistOfAlbum(int albumIdx) const {
+    return std::min(albumIdx / 10, myNumberOfArtists - 1);
+}
+
+
+
+std::string SyntheticLibrary::createName(int idx) const {
+    auto numberOfWords = static_cast<int>(WORDS.size());
+    return WORDS[(idx * 7) % numberOfWords] + " " + WORDS[(idx * 13 + 5) % numberOfWords] + " " +
+        std::to_string(idx);
+}
+
+}
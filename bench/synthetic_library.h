@@ -0,0 +1,162 @@
+// synthetic_library.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef SYNTHETICLIBRARY_H
+#define SYNTHETICLIBRARY_H
+
+
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "data/indices.h"
+
+namespace data {
+class ArtistData;
+class AlbumData;
+class TrackData;
+class IdInterner;
+}
+
+
+
+namespace bench {
+
+/**
+ * @brief Generated music library of a given size.
+ *
+ * Each album has about 10 tracks and each artist has about 10 albums.  All tracks of an album belong to the artist
+ * of the album.  The content is deterministic so the results of runs can be compared.
+ */
+class SyntheticLibrary {
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param numberOfTracks Number of tracks in the library.
+     */
+    explicit SyntheticLibrary(int numberOfTracks);
+
+    ~SyntheticLibrary();
+
+    SyntheticLibrary(const SyntheticLibrary& other) = delete;
+
+    SyntheticLibrary& operator=(const SyntheticLibrary& other) = delete;
+
+    int numberOfArtists() const;
+
+    int numberOfAlbums() const;
+
+    int numberOfTracks() const;
+
+    /**
+     * @brief Interner of artist IDs the data of the library refer to.
+     */
+    data::IdInterner& getArtistIds() const;
+
+    /**
+     * @brief Interner of album IDs the data of the library refer to.
+     */
+    data::IdInterner& getAlbumIds() const;
+
+    /**
+     * @brief Creates data of all artists.
+     */
+    std::vector<std::unique_ptr<data::ArtistData>> createArtistsData() const;
+
+    /**
+     * @brief Creates data of all albums.
+     */
+    std::vector<std::unique_ptr<data::AlbumData>> createAlbumsData() const;
+
+    /**
+     * @brief Creates data of all tracks.
+     */
+    std::vector<std::unique_ptr<data::TrackData>> createTracksData() const;
+
+    /**
+     * @brief Sets artists of albums and artists and albums of tracks the same way the repositories do when loading.
+     *
+     * @param artistsData Data created by createArtistsData().
+     * @param albumsData Data created by createAlbumsData().
+     * @param tracksData Data created by createTracksData().
+     */
+    void link(const std::vector<std::unique_ptr<data::ArtistData>>& artistsData,
+        const std::vector<std::unique_ptr<data::AlbumData>>& albumsData,
+        const std::vector<std::unique_ptr<data::TrackData>>& tracksData) const;
+
+    /**
+     * @brief Creates index of albums by their artists the same way the album repository does.
+     */
+    data::ArtistAlbumsIndex createArtistAlbumsIndex(
+        const std::vector<std::unique_ptr<data::AlbumData>>& albumsData) const;
+
+    /**
+     * @brief Creates index of tracks by their artists the same way the track repository does.
+     */
+    data::ArtistTracksIndex createArtistTracksIndex(
+        const std::vector<std::unique_ptr<data::TrackData>>& tracksData) const;
+
+    /**
+     * @brief Creates index of tracks by their albums the same way the track repository does.
+     */
+    data::AlbumTracksIndex createAlbumTracksIndex(
+        const std::vector<std::unique_ptr<data::TrackData>>& tracksData) const;
+
+    /**
+     * @brief Creates a response of the Ampache server to the handshake method.
+     */
+    std::string createHandshakeXml() const;
+
+    /**
+     * @brief Creates a response of the Ampache server to the artists method.
+     *
+     * @param offset Offset of the first returned artist.
+     * @param limit Maximal number of returned artists.
+     */
+    std::string createArtistsXml(int offset, int limit) const;
+
+    /**
+     * @brief Creates a response of the Ampache server to the albums method.
+     *
+     * @param offset Offset of the first returned album.
+     * @param limit Maximal number of returned albums.
+     */
+    std::string createAlbumsXml(int offset, int limit) const;
+
+    /**
+     * @brief Creates a response of the Ampache server to the songs method.
+     *
+     * @param offset Offset of the first returned track.
+     * @param limit Maximal number of returned tracks.
+     */
+    std::string createTracksXml(int offset, int limit) const;
+
+private:
+    // arguments from the constructor
+    const int myNumberOfTracks;
+
+    const int myNumberOfAlbums;
+    const int myNumberOfArtists;
+    const std::unique_ptr<data::IdInterner> myArtistIds;
+    const std::unique_ptr<data::IdInterner> myAlbumIds;
+
+    int toIdx(const std::string& id) const;
+    int getAlbumOfTrack(int trackIdx) const;
+    int getArtistOfAlbum(int albumIdx) const;
+    std::string createName(int idx) const;
+};
+
+}
+
+
+
+#endif // SYNTHETICLIBRARY_H
@@ -25,6 +25,7 @@ class QWidget;
 namespace data {
 class Cache;
 class Indices;
+class IdInterner;
 class ArtistRepository;
 class AlbumRepository;
 class TrackRepository;
@@ -131,6 +132,10 @@ private:
     std::function<void(std::vector<std::string>)> myAddToPlaylistCb = [](const std::vector<std::string>&) { };
     std::function<void()> myFinishedCb;
 
+    // interned IDs of artists and albums; they outlive the data which refer to them
+    const std::unique_ptr<data::IdInterner> myArtistIds;
+    const std::unique_ptr<data::IdInterner> myAlbumIds;
+
     std::unique_ptr<ui::Ui> myUi;
     std::unique_ptr<application::DataLoader> myDataLoader;
     std::unique_ptr<data::Ampache> myAmpache;
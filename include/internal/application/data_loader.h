@@ -12,15 +12,25 @@
 
 
 
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include "infrastructure/event/event.h"
 #include "data/provider_type.h"
 
 namespace data {
+template <typename T>
+struct ReadyData;
+class ArtistData;
+class AlbumData;
+class TrackData;
 class ArtistRepository;
 class AlbumRepository;
 class TrackRepository;
 class Ampache;
 class Cache;
+class IdInterner;
 }
 
 
@@ -61,8 +71,22 @@ enum class LoadingResult {
 class DataLoader {
 
 public:
+    /**
+     * @brief Constructor.
+     *
+     * @param artistRepository Repository of artists that shall be loaded.
+     * @param albumRepository Repository of albums that shall be loaded.
+     * @param trackRepository Repository of tracks that shall be loaded.
+     * @param ampache Used for communication with Ampache server.
+     * @param cache Used for accessing the disk cache.
+     * @param artistIds Interner of artist IDs; cleared when all data are loaded again.
+     * @param albumIds Interner of album IDs; cleared when all data are loaded again.
+     */
     explicit DataLoader(data::ArtistRepository* const artistRepository, data::AlbumRepository* const albumRepository,
-        data::TrackRepository* const trackRepository, data::Ampache& ampache, data::Cache& cache);
+        data::TrackRepository* const trackRepository, data::Ampache& ampache, data::Cache& cache,
+        data::IdInterner& artistIds, data::IdInterner& albumIds);
+
+    ~DataLoader();
 
     /**
      * @brief Fired when loading is finished.
@@ -105,6 +129,8 @@ private:
     data::TrackRepository* const myTrackRepository = nullptr;
     data::Ampache& myAmpache;
     data::Cache& myCache;
+    data::IdInterner& myArtistIds;
+    data::IdInterner& myAlbumIds;
 
     // current loading state
     State myState = Idle;
@@ -114,6 +140,7 @@ private:
 
     // true if initialization or loading of particular data has finished
     bool myAmpacheInitializationFinished = false;
+    bool myCacheUpdateFinished = false;
     bool myArtistsLoadingFinished = false;
     bool myAlbumsLoadingFinished = false;
     bool myAlbumArtsLoadingFinished = false;
@@ -122,8 +149,24 @@ private:
     // data provider which is currently used
     data::ProviderType myProviderType = data::ProviderType::None;
 
+    // index of the current cache update step and offset of the next page which is going to be requested in it
+    int myCacheUpdateStep = 0;
+    int myCacheUpdateOffset = 0;
+
+    // time point when the cache update has begun, moved back by a margin for the clock difference to the server
+    std::chrono::system_clock::time_point myCacheUpdateBegin;
+
+    // data changed on the server since the last cache update
+    std::vector<std::unique_ptr<data::ArtistData>> myChangedArtistsData;
+    std::vector<std::unique_ptr<data::AlbumData>> myChangedAlbumsData;
+    std::vector<std::unique_ptr<data::TrackData>> myChangedTracksData;
+
     void onAmpacheInitialized(bool error);
 
+    void onChangedArtistsReady(data::ReadyData<data::ArtistData>& artistsData);
+    void onChangedAlbumsReady(data::ReadyData<data::AlbumData>& albumsData);
+    void onChangedTracksReady(data::ReadyData<data::TrackData>& tracksData);
+
     void onArtistsFullyLoaded(bool error);
     void onAlbumsFullyLoaded(bool error);
     void onTracksFullyLoaded(bool error);
@@ -134,6 +177,13 @@ private:
     void onAlbumRepositoryArtsLoadingDisabled();
     void onTrackRepositoryLoadingDisabled();
 
+    void beginCacheUpdate();
+    void requestChangedData();
+    template <typename T>
+    bool processChangedData(data::ReadyData<T>& changedData, std::vector<std::unique_ptr<T>>& accumulatedData);
+    void finishCacheUpdate(bool error);
+    void startLoading();
+    void linkLoadedData();
     void possiblyFireFinishedOrAborted();
     void fireFinished(LoadingResult loadingResult);
     void fireAborted();
@@ -15,6 +15,7 @@
 #include <memory>
 #include <QtCore/QAbstractListModel>
 #include "src/application/models/requests.h"
+#include "src/application/models/update_coalescer.h"
 
 namespace data {
 class AlbumRepository;
@@ -68,7 +69,7 @@ private:
     int const myThumbnailSize = 0;
 
     // requests to load albums from an external source
-    const std::unique_ptr<Requests> myAlbumRequests{new Requests{60}};
+    const std::unique_ptr<Requests> myAlbumRequests;
 
     // requests to load album arts from an external source
     const std::unique_ptr<Requests> myArtRequests{new Requests{3}};
@@ -78,15 +79,24 @@ private:
     // requested using unfiltered offsets
     mutable bool myIsInUnfilteredArtsLoadMode = false;
 
+    // changes of data which are applied to views at most once per display frame
+    const std::unique_ptr<UpdateCoalescer> myUpdateCoalescer{new UpdateCoalescer{}};
+
+    // number of rows as it was notified to views; it differs from the repository count until the changes are applied
+    int myRowCount = 0;
+
     void onReadyToExecuteAlbums(RequestGroup requestGroup);
     void onLoaded(std::pair<int, int> offsetAndLimit);
     void onReadyToExecuteArts(RequestGroup requestGroup);
     void onArtsLoaded(std::pair<int, int> offsetAndCount);
-    void onDataSizeOrFilterChanged();
+    void onDataSizeChanged();
+    void onFilterChanged();
+    void onReadyToApply(ModelUpdate& modelUpdate);
     void onProviderChanged();
 
     void requestAllData();
     void requestUnloadedArts();
+    void restartArtsLoading();
 };
 
 }
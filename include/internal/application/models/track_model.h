@@ -15,6 +15,7 @@
 #include <memory>
 #include <QtCore/QAbstractTableModel>
 #include "src/application/models/requests.h"
+#include "src/application/models/update_coalescer.h"
 
 namespace data {
 class TrackRepository;
@@ -66,11 +67,19 @@ private:
     data::TrackRepository* const myTrackRepository = nullptr;
 
     // requests to load tracks from an external source
-    const std::unique_ptr<Requests> myRequests{new Requests{60}};
+    const std::unique_ptr<Requests> myRequests;
+
+    // changes of data which are applied to views at most once per display frame
+    const std::unique_ptr<UpdateCoalescer> myUpdateCoalescer{new UpdateCoalescer{}};
+
+    // number of rows as it was notified to views; it differs from the repository count until the changes are applied
+    int myRowCount = 0;
 
     void onReadyToExecute(RequestGroup requestGroup);
     void onLoaded(std::pair<int, int> offsetAndLimit);
-    void onDataSizeOrFilterChanged();
+    void onDataSizeChanged();
+    void onFilterChanged();
+    void onReadyToApply(ModelUpdate& modelUpdate);
     void onProviderChanged();
 
     void requestAllData();
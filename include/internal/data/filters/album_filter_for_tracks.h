@@ -54,12 +54,17 @@ public:
 
     void processUpdatedSourceData(int offset = -1, int length = -1) override;
 
+protected:
+    Order getOrder() const override;
+
 private:
     // arguments from the constructor
-    const std::vector<std::reference_wrapper<const domain::Album>> myAlbums;
     Indices& myIndices;
 
-    void onAlbumTracksUpdated(const std::vector<std::reference_wrapper<const domain::Album>>& updatedAlbums);
+    // ID handles of the albums from the constructor
+    std::vector<int> myAlbumIdHandles;
+
+    void onAlbumTracksUpdated(const std::vector<int>& updatedAlbums);
 
     void processUpdatedIndices();
 };
@@ -54,12 +54,17 @@ public:
 
     void processUpdatedSourceData(int offset = -1, int length = -1) override;
 
+protected:
+    Order getOrder() const override;
+
 private:
     // arguments from the constructor
-    const std::vector<std::reference_wrapper<const domain::Artist>> myArtists;
     Indices& myIndices;
 
-    void onArtistAlbumsUpdated(const std::vector<std::reference_wrapper<const domain::Artist>>& updatedArtists);
+    // ID handles of the artists from the constructor
+    std::vector<int> myArtistIdHandles;
+
+    void onArtistAlbumsUpdated(const std::vector<int>& updatedArtists);
 
     void processUpdatedIndices();
 };
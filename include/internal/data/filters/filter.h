@@ -20,6 +20,65 @@
 
 namespace data {
 
+/**
+ * @brief Data items removed from or inserted to filtered data at once.
+ */
+struct FilteredDataChange {
+
+    /**
+     * @brief true if the data items were inserted, false if they were removed.
+     */
+    bool isInsertion;
+
+    /**
+     * @brief Offset of the first data item in the filtered data with all preceding changes applied.
+     */
+    int offset;
+
+    /**
+     * @brief Number of the data items.
+     */
+    int count;
+};
+
+
+
+/**
+ * @brief Filtered data as they were at some moment; changes since then can be determined by Filter::getChangesSince().
+ *
+ * Only what is needed to determine the changes is stored: offsets of the data items in the source data for filters
+ * which keep the order of the source data, the data items themselves for filters which order them differently and
+ * nothing but the size if all source data items were included.
+ *
+ * @sa Filter::takeSnapshot()
+ */
+template <typename T>
+struct FilteredDataSnapshot {
+
+    /**
+     * @brief Order of the data items; nullptr if they are in the order of the source data.
+     */
+    bool (*order)(const T* lhs, const T* rhs) = nullptr;
+
+    /**
+     * @brief Number of the data items.
+     */
+    int size = 0;
+
+    /**
+     * @brief Offsets of the data items in the source data if they are in its order; empty if the data items are all
+     * source data items.
+     */
+    std::vector<int> offsets;
+
+    /**
+     * @brief The data items if they are not in the order of the source data.
+     */
+    std::vector<T*> dataItems;
+};
+
+
+
 /**
  * @brief Base class for filters.
  */
@@ -60,6 +119,47 @@ public:
      */
     const std::vector<T*>& getFilteredData() const;
 
+    /**
+     * @brief Stores the current filtered data so that their changes can be determined later.
+     *
+     * @param snapshot Filled by the current filtered data; memory it holds and does not need anymore is freed.
+     */
+    void takeSnapshot(FilteredDataSnapshot<T>& snapshot) const;
+
+    /**
+     * @brief Gets changes which transform the given previous filtered data to the current ones.
+     *
+     * The changes are computed by a single merge of both data by the order of this filter; the previous data have to
+     * be ordered the same way which is true for all snapshots of this filter and of filters that order data items
+     * the same way.  Changes are ordered by their offsets; consecutive data items are removed or inserted by a single
+     * change and removals precede insertions at the same offset.
+     *
+     * @param snapshot Filtered data as they were taken earlier, from this or another filter.
+     * @param changes Filled by the changes.
+     * @return false if the changes can not be determined because the data items are ordered differently.
+     */
+    bool getChangesSince(const FilteredDataSnapshot<T>& snapshot, std::vector<FilteredDataChange>& changes) const;
+
+protected:
+    /**
+     * @brief Order of data items of filters which do not keep the order of the source data.
+     */
+    using Order = bool (*)(const T* lhs, const T* rhs);
+
+    /**
+     * @brief Gets the order of the filtered data.
+     *
+     * @return nullptr if the filtered data are in the order of the source data which is the default.
+     */
+    virtual Order getOrder() const;
+
+    /**
+     * @brief Gets offsets of the filtered data in the source data; used only if getOrder() returns nullptr.
+     *
+     * @return nullptr if the filtered data are all source data which is the default.
+     */
+    virtual const std::vector<int>* getFilteredOffsets() const;
+
 protected:
     // stores source data
     const std::vector<std::unique_ptr<T>>* mySourceData{};
@@ -0,0 +1,149 @@
+// name_filter.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef NAMEFILTER_H
+#define NAMEFILTER_H
+
+
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <utility>
+
+#include "filter.h"
+#include "name_matcher.h"
+
+
+
+namespace data {
+
+class NameIndex;
+
+
+
+/**
+ * @brief Base class for filters which provide data filtered by name.
+ *
+ * Filter is making exact, case insensitive match of the data item's name as it is stored in the name index with the
+ * given pattern.
+ *
+ * Provided filtered data via ::getFilteredData() does not contain uninitialized (null) elements.
+ *
+ * Only names which contain all trigrams of the pattern according to the name index are matched; all source data are
+ * matched only if the pattern is too short to be searched in the index.  When the pattern extends the pattern of the
+ * previous filter only the result of the previous filter is matched.
+ *
+ * The matching can be done in advance, e. g. on another thread, by selectCandidates() and matchCandidates(); the
+ * result is then passed to the constructor.
+ *
+ * When a range of source data is updated only the data items in that range are matched and merged into the result.
+ */
+template <typename T>
+class NameFilter: public Filter<T> {
+
+public:
+    /**
+     * @brief Data items with their offsets in the source data ordered by the offsets.
+     */
+    using DataItems = std::vector<std::pair<int, T*>>;
+
+    /**
+     * @brief Data items which names shall be matched.
+     */
+    using Candidates = std::vector<NameCandidate<T>>;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param namePattern The pattern that shall be used to match the data item's name.
+     * @param nameIndex Index of names of the source data by their offsets.
+     * @param previousFilter Filter which is set to the source data currently.  If @p namePattern contains its pattern
+     *        then its result is refined instead of matching all source data.
+     */
+    explicit NameFilter(const std::string& namePattern, const NameIndex& nameIndex,
+        const NameFilter<T>* previousFilter = nullptr);
+
+    /**
+     * @brief Constructor.
+     *
+     * @param namePattern The pattern that shall be used to match the data item's name.
+     * @param nameIndex Index of names of the source data by their offsets.
+     * @param filteredData The result of the filter obtained by matchCandidates() from the source data that will be
+     *        set.
+     */
+    explicit NameFilter(const std::string& namePattern, const NameIndex& nameIndex,
+        const DataItems& filteredData);
+
+    void processUpdatedSourceData(int offset = -1, int length = -1) override;
+
+    /**
+     * @brief Selects source data items which names might contain the given pattern.
+     *
+     * @param namePattern The pattern that shall be used to match the data item's name.
+     * @param nameIndex Index of names of the source data by their offsets.
+     * @param sourceData The data that shall be filtered.
+     * @param previousFilter Filter which is set to the source data currently.  If @p namePattern contains its pattern
+     *        then its result is selected.
+     * @return The candidates.
+     */
+    static Candidates selectCandidates(const std::string& namePattern, const NameIndex& nameIndex,
+        const std::vector<std::unique_ptr<T>>& sourceData, const NameFilter<T>* previousFilter = nullptr);
+
+    /**
+     * @brief Matches names of the given candidates with the given pattern.
+     *
+     * Only the folded names of the candidates are accessed so it is safe to call the function from another thread
+     * than the one the source data are updated in as long as the name index is not cleared.  Large numbers of
+     * candidates are matched in parallel.
+     *
+     * @param namePattern The pattern that shall be used to match the data item's name.
+     * @param nameIndex Index of names of the source data by their offsets.
+     * @param candidates Data items selected by selectCandidates().
+     * @param isCancelled Called periodically; if it returns true the matching is abandoned.
+     * @return The candidates which names contain the pattern.  Incomplete if the matching was abandoned.
+     */
+    static DataItems matchCandidates(const std::string& namePattern, const NameIndex& nameIndex,
+        const Candidates& candidates, const std::function<bool()>& isCancelled = nullptr);
+
+protected:
+    const std::vector<int>* getFilteredOffsets() const override;
+
+private:
+    // arguments from the constructor
+    const std::string myNamePattern;
+    const NameIndex& myNameIndex;
+
+    // the pattern folded by the name index
+    const std::string myFoldedNamePattern;
+
+    // offsets of the filtered data in the source data
+    std::vector<int> myFilteredOffsets;
+
+    // true if the filtered data were computed in advance and the source data were not processed yet
+    bool myIsPrecomputed = false;
+
+    static Candidates createCandidates(const DataItems& dataItems, const NameIndex& nameIndex);
+    static bool isRefining(const std::string& foldedNamePattern, const NameFilter<T>& previousFilter);
+
+    DataItems getFilteredDataItems() const;
+    void setFilteredData(const DataItems& filteredData);
+    void updateFilteredData(int offset, int length);
+};
+
+}
+
+
+
+#include "src/data/filters/name_filter.cc"
+
+
+
+#endif // NAMEFILTER_H
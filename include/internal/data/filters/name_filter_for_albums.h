@@ -12,9 +12,7 @@
 
 
 
-#include <vector>
-#include <memory>
-#include "filter.h"
+#include "name_filter.h"
 
 
 
@@ -27,24 +25,12 @@ class AlbumData;
 /**
  * @brief Provides albums data filtered by name.
  *
- * Filter is making exact, case insensitive match of the album's name (domain::Album::getName()) with the given pattern.
- *
- * Provided filtered data via ::getFilteredData() does not contain uninitialized (null) elements.
+ * See NameFilter.
  */
-class NameFilterForAlbums: public Filter<AlbumData> {
+class NameFilterForAlbums: public NameFilter<AlbumData> {
 
 public:
-    /**
-     * @brief Constructor.
-     *
-     * @param namePattern The pattern that shall be used to match the album's name.
-     */
-    explicit NameFilterForAlbums(const std::string& namePattern);
-
-    void processUpdatedSourceData(int offset = -1, int length = -1) override;
-
-private:
-    const std::string myNamePattern;
+    using NameFilter<AlbumData>::NameFilter;
 };
 
 }
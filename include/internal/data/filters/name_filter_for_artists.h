@@ -12,7 +12,7 @@
 
 
 
-#include "filter.h"
+#include "name_filter.h"
 
 
 
@@ -25,25 +25,12 @@ class ArtistData;
 /**
  * @brief Provides artists data filtered by name.
  *
- * Filter is making exact, case insensitive match of the artist's name (domain::Album::getName()) with the given
- * pattern.
- *
- * Provided filtered data via ::getFilteredData() does not contain uninitialized (null) elements.
+ * See NameFilter.
  */
-class NameFilterForArtists: public Filter<ArtistData> {
+class NameFilterForArtists: public NameFilter<ArtistData> {
 
 public:
-    /**
-     * @brief Constructor.
-     *
-     * @param namePattern The pattern that shall be used to match the artist's name.
-     */
-    explicit NameFilterForArtists(const std::string& namePattern);
-
-    void processUpdatedSourceData(int offset = -1, int length = -1) override;
-
-private:
-    const std::string myNamePattern;
+    using NameFilter<ArtistData>::NameFilter;
 };
 
 }
@@ -12,7 +12,7 @@
 
 
 
-#include "filter.h"
+#include "name_filter.h"
 
 
 
@@ -25,24 +25,12 @@ class TrackData;
 /**
  * @brief Provides tracks data filtered by name.
  *
- * Filter is making exact, case insensitive match of the track's name (domain::Album::getName()) with the given pattern.
- *
- * Provided filtered data via ::getFilteredData() does not contain uninitialized (null) elements.
+ * See NameFilter.
  */
-class NameFilterForTracks: public Filter<TrackData> {
+class NameFilterForTracks: public NameFilter<TrackData> {
 
 public:
-    /**
-     * @brief Constructor.
-     *
-     * @param namePattern The pattern that shall be used to match the track's name.
-     */
-    explicit NameFilterForTracks(const std::string& namePattern);
-
-    void processUpdatedSourceData(int offset = -1, int length = -1) override;
-
-private:
-    const std::string myNamePattern;
+    using NameFilter<TrackData>::NameFilter;
 };
 
 }
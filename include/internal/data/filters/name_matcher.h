@@ -0,0 +1,82 @@
+// name_matcher.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef NAMEMATCHER_H
+#define NAMEMATCHER_H
+
+
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <utility>
+
+
+
+namespace infrastructure {
+class CaseInsensitiveSearch;
+}
+
+
+
+namespace data {
+
+/**
+ * @brief Data item which name shall be matched.
+ */
+template <typename T>
+struct NameCandidate {
+    // offset of the data item in the source data
+    int offset;
+    T* dataItem;
+    // folded name of the data item (see NameIndex::getFoldedName())
+    std::string_view foldedName;
+};
+
+
+
+/**
+ * @brief Matches folded names of data items with a folded pattern.
+ *
+ * Matching is exact (see infrastructure::CaseInsensitiveSearch).  Only the folded names are accessed, not the data
+ * items.  Large numbers of data items are partitioned into chunks which are matched in parallel by the global thread
+ * pool.
+ */
+template <typename T>
+class NameMatcher {
+
+public:
+    /**
+     * @brief Matches names of the given candidates with the given pattern.
+     *
+     * @param foldedPattern The folded pattern that shall be used to match the names.
+     * @param candidates Data items which names shall be matched.
+     * @param isCancelled Called periodically; if it returns true the matching is abandoned.
+     * @return The data items which names contain the pattern with their offsets in the order they were given.
+     *         Incomplete if the matching was abandoned.
+     */
+    static std::vector<std::pair<int, T*>> match(const std::string& foldedPattern,
+        const std::vector<NameCandidate<T>>& candidates, const std::function<bool()>& isCancelled = nullptr);
+
+private:
+    static void matchChunk(const infrastructure::CaseInsensitiveSearch& search, const NameCandidate<T>* begin,
+        const NameCandidate<T>* end, const std::function<bool()>& isCancelled,
+        std::vector<std::pair<int, T*>>& matchingDataItems);
+};
+
+}
+
+
+
+#include "src/data/filters/name_matcher.cc"
+
+
+
+#endif // NAMEMATCHER_H
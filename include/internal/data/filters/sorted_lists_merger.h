@@ -0,0 +1,51 @@
+// sorted_lists_merger.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef SORTEDLISTSMERGER_H
+#define SORTEDLISTSMERGER_H
+
+
+
+#include <vector>
+#include <functional>
+
+
+
+namespace data {
+
+/**
+ * @brief Merges sorted lists of data items into a single sorted list.
+ *
+ * The lists are merged by a k-way merge; the result is built in a single pass without intermediate containers.
+ */
+template <typename T>
+class SortedListsMerger {
+
+public:
+    /**
+     * @brief Merges the given lists.
+     *
+     * @param lists Lists sorted by @p isBefore; each list shall not contain duplicates.
+     * @param isBefore Strict weak ordering of the data items under which only identical data items are equivalent.
+     * @param merged Filled by the data items of all lists in the order given by @p isBefore.  Data items contained in
+     *        multiple lists are included once.
+     */
+    static void merge(const std::vector<const std::vector<T*>*>& lists,
+        const std::function<bool(const T*, const T*)>& isBefore, std::vector<T*>& merged);
+};
+
+}
+
+
+
+#include "src/data/filters/sorted_lists_merger.cc"
+
+
+
+#endif // SORTEDLISTSMERGER_H
@@ -0,0 +1,92 @@
+// id_interner.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef IDINTERNER_H
+#define IDINTERNER_H
+
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <shared_mutex>
+
+
+
+namespace data {
+
+/**
+ * @brief Maps identifiers to dense integer handles.
+ *
+ * Each distinct identifier is stored once; handles are assigned from 0 in the order the identifiers are interned.
+ * Identifiers are removed only by clear() so a handle stays valid until then.  Instances are owned by the
+ * application session which loads the data that refer to the handles.
+ *
+ * It is safe to use the interner from multiple threads.
+ */
+class IdInterner {
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param reservedIds Identifiers which get the first handles in the given order; clear() keeps them.
+     */
+    explicit IdInterner(const std::vector<std::string>& reservedIds = {});
+
+    IdInterner(const IdInterner& other) = delete;
+
+    IdInterner& operator=(const IdInterner& other) = delete;
+
+    /**
+     * @brief Interns the given identifier.
+     *
+     * @param id The identifier.
+     * @return Handle of the identifier; the same identifier gets always the same handle until clear() is called.
+     */
+    int intern(const std::string& id);
+
+    /**
+     * @brief Gets the identifier of the given handle.
+     *
+     * @param handle Handle returned by intern().
+     * @return The identifier.  The reference stays valid until clear() is called.
+     */
+    const std::string& getId(int handle) const;
+
+    /**
+     * @brief Removes all identifiers except the reserved ones.
+     *
+     * Handles of the removed identifiers become invalid; identifiers interned later may get them.  Should be called
+     * when no data refer to the handles anymore, e. g. when all data are reloaded.
+     */
+    void clear();
+
+private:
+    // argument from the constructor
+    const std::vector<std::string> myReservedIds;
+
+    // protects the identifiers and handles
+    mutable std::shared_mutex myMutex;
+
+    // <identifier, handle> map
+    std::unordered_map<std::string, int> myHandles;
+
+    // identifiers by their handles; they point to the keys of myHandles
+    std::vector<const std::string*> myIds;
+
+    // the mutex has to be locked exclusively unless called from the constructor
+    int add(const std::string& id);
+};
+
+}
+
+
+
+#endif // IDINTERNER_H
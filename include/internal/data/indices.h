@@ -13,9 +13,8 @@
 
 
 #include <vector>
-#include <unordered_set>
-#include <unordered_map>
-#include <memory>
+#include <functional>
+#include <utility>
 #include "infrastructure/event/event.h"
 #include "domain/artist.h"
 #include "domain/album.h"
@@ -26,56 +25,100 @@
 
 namespace data {
 
-using AlbumDataUnorderedSet = std::unordered_set<std::reference_wrapper<AlbumData>, std::hash<AlbumData>>;
+class IdInterner;
 
-using TrackDataUnorderedSet = std::unordered_set<std::reference_wrapper<TrackData>, std::hash<TrackData>>;
 
-using ArtistAlbumsIndex = std::unordered_map<
-    std::reference_wrapper<const domain::Artist>, AlbumDataUnorderedSet,
-    std::hash<domain::Artist>>;
 
-using ArtistTracksIndex = std::unordered_map<
-    std::reference_wrapper<const domain::Artist>, TrackDataUnorderedSet,
-    std::hash<domain::Artist>>;
+/**
+ * @brief Entries of the artist-albums index: <artist ID handle, album data>.
+ */
+using ArtistAlbumsIndex = std::vector<std::pair<int, AlbumData*>>;
+
+/**
+ * @brief Entries of the artist-tracks index: <artist ID handle, track data>.
+ */
+using ArtistTracksIndex = std::vector<std::pair<int, TrackData*>>;
 
-using AlbumTracksIndex = std::unordered_map<
-    std::reference_wrapper<const domain::Album>, TrackDataUnorderedSet,
-    std::hash<domain::Album>>;
+/**
+ * @brief Entries of the album-tracks index: <album ID handle, track data>.
+ */
+using AlbumTracksIndex = std::vector<std::pair<int, TrackData*>>;
 
 
 
 /**
  * @brief Provides fast access to domain data.
+ *
+ * Artists and albums are identified by handles of their IDs interned by the interners given to the constructor.  The
+ * handles are dense so the data of each artist or album are stored in a contiguous
+ * list at the position of the handle; they are accessed without hashing.
+ *
+ * The lists are kept sorted in the order in which the data are displayed (see isArtistAlbumBefore(),
+ * isArtistTrackBefore() and isAlbumTrackBefore()) and they do not contain duplicates.  The data of several artists or
+ * albums can be therefore merged in linear time.
  */
 class Indices {
 
 public:
+    /**
+     * @brief Constructor.
+     *
+     * @param artistIds Interner of IDs of artists.
+     * @param albumIds Interner of IDs of albums.
+     */
+    explicit Indices(IdInterner& artistIds, IdInterner& albumIds);
+
     /**
      * @brief Event fired when artist-albums index has been updated.
      *
-     * @param updatedArtists Artists which have been updated. Empty if all artists were updated.
+     * @param updatedArtists ID handles of artists which have been updated. Empty if all artists were updated.
      *
      * @sa getArtistAlbums(), updateArtistAlbums()
      */
-    infrastructure::Event<std::vector<std::reference_wrapper<const domain::Artist>>> artistAlbumsUpdated{};
+    infrastructure::Event<std::vector<int>> artistAlbumsUpdated{};
 
     /**
      * @brief Event fired when artist-tracks index has been updated.
      *
-     * @param updatedArtists Artists which have been updated. Empty if all artists were updated.
+     * @param updatedArtists ID handles of artists which have been updated. Empty if all artists were updated.
      *
      * @sa getArtistTracks(), updateArtistTracks()
      */
-    infrastructure::Event<std::vector<std::reference_wrapper<const domain::Artist>>> artistTracksUpdated{};
+    infrastructure::Event<std::vector<int>> artistTracksUpdated{};
 
     /**
      * @brief Event fired when album-tracks index has been updated.
      *
-     * @param updatedAlbums Albums which have been updated. Empty if all albums were updated.
+     * @param updatedAlbums ID handles of albums which have been updated. Empty if all albums were updated.
      *
      * @sa getAlbumTracks(), updateAlbumTracks()
      */
-    infrastructure::Event<std::vector<std::reference_wrapper<const domain::Album>>> albumTracksUpdated{};
+    infrastructure::Event<std::vector<int>> albumTracksUpdated{};
+
+    /**
+     * @brief Gets the handle of the ID of the given artist.
+     */
+    int getArtistIdHandle(const domain::Artist& artist) const;
+
+    /**
+     * @brief Gets the handle of the ID of the given album.
+     */
+    int getAlbumIdHandle(const domain::Album& album) const;
+
+    /**
+     * @brief Order of albums data of artists; albums are ordered by their domain objects.
+     */
+    static bool isArtistAlbumBefore(const AlbumData* lhs, const AlbumData* rhs);
+
+    /**
+     * @brief Order of tracks data of artists; tracks are ordered by their names (see TrackData::NameCompare).
+     */
+    static bool isArtistTrackBefore(const TrackData* lhs, const TrackData* rhs);
+
+    /**
+     * @brief Order of tracks data of albums; tracks are ordered by their domain objects.
+     */
+    static bool isAlbumTrackBefore(const TrackData* lhs, const TrackData* rhs);
 
     /**
      * @brief Adds specified artists to all artist indices.
@@ -96,18 +139,20 @@ public:
     void addAlbums(const std::vector<std::reference_wrapper<domain::Album>>& albums);
 
     /**
-     * @brief Gets albums data for the given @p artist.
+     * @brief Gets albums data for the given artist.
      *
-     * @param artist The artist which albums data shall be returned.
-     * @return Albums data.
+     * @param artistIdHandle ID handle of the artist which albums data shall be returned.
+     * @return Albums data sorted by isArtistAlbumBefore().  Empty if the artist is not in the index.
      *
      * @sa updateArtistAlbums(), artistAlbumsUpdated
      */
-    AlbumDataUnorderedSet& getArtistAlbums(const domain::Artist& artist);
+    const std::vector<AlbumData*>& getArtistAlbums(int artistIdHandle) const;
 
     /**
      * @brief Updates artist-albums index by inserting the given data.
      *
+     * Albums data which are in the index already are not inserted again.
+     *
      * @param artistAlbums Artists with corresponding albums data which shall be inserted to the index.
      *
      * @sa getArtistAlbums(), artistAlbumsUpdated
@@ -115,18 +160,20 @@ public:
     void updateArtistAlbums(const ArtistAlbumsIndex& artistAlbums);
 
     /**
-     * @brief Gets tracks data for the given @p artist.
+     * @brief Gets tracks data for the given artist.
      *
-     * @param artist The artist which tracks data shall be returned.
-     * @return Tracks data.
+     * @param artistIdHandle ID handle of the artist which tracks data shall be returned.
+     * @return Tracks data sorted by isArtistTrackBefore().  Empty if the artist is not in the index.
      *
      * @sa updateArtistTracks(), artistTracksUpdated
      */
-    TrackDataUnorderedSet& getArtistTracks(const domain::Artist& artist);
+    const std::vector<TrackData*>& getArtistTracks(int artistIdHandle) const;
 
     /**
      * @brief Updates artist-tracks index by inserting the given data.
      *
+     * Tracks data which are in the index already are not inserted again.
+     *
      * @param artistTracks Artists with corresponding tracks data which shall be inserted to the index.
      *
      * @sa getArtistTracks(), artistTracksUpdated
@@ -134,18 +181,20 @@ public:
     void updateArtistTracks(const ArtistTracksIndex& artistTracks);
 
     /**
-     * @brief Gets tracks data for the given @p album.
+     * @brief Gets tracks data for the given album.
      *
-     * @param album The album which tracks data shall be returned.
-     * @return Tracks data.
+     * @param albumIdHandle ID handle of the album which tracks data shall be returned.
+     * @return Tracks data sorted by isAlbumTrackBefore().  Empty if the album is not in the index.
      *
      * @sa updateAlbumTracks(), albumTracksUpdated
      */
-    TrackDataUnorderedSet& getAlbumTracks(const domain::Album& album);
+    const std::vector<TrackData*>& getAlbumTracks(int albumIdHandle) const;
 
     /**
      * @brief Updates album-tracks index by inserting the given data.
      *
+     * Tracks data which are in the index already are not inserted again.
+     *
      * @param albumTracks Albums with corresponding tracks data which shall be inserted to the index.
      *
      * @sa updateAlbumTracks(), albumTracksUpdated
@@ -188,14 +237,18 @@ public:
     void clearAlbumsTracks();
 
 private:
-    // <artist, albums data> map
-    ArtistAlbumsIndex myArtistAlbums;
+    // arguments from the constructor
+    IdInterner& myArtistIds;
+    IdInterner& myAlbumIds;
+
+    // albums data by artist ID handles
+    std::vector<std::vector<AlbumData*>> myArtistAlbums;
 
-    // <artist, tracks data> map
-    ArtistTracksIndex myArtistTracks;
+    // tracks data by artist ID handles
+    std::vector<std::vector<TrackData*>> myArtistTracks;
 
-    // <album, tracks data> map
-    AlbumTracksIndex myAlbumTracks;
+    // tracks data by album ID handles
+    std::vector<std::vector<TrackData*>> myAlbumTracks;
 };
 
 }
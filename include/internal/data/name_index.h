@@ -0,0 +1,117 @@
+// name_index.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef NAMEINDEX_H
+#define NAMEINDEX_H
+
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+
+
+namespace data {
+
+/**
+ * @brief Inverted index of names by their trigrams for fast substring search.
+ *
+ * Names are identified by their position (typically an offset in the repository data).  For each trigram (three
+ * consecutive characters) of a name the position is stored in a sorted posting list of that trigram.  A substring
+ * query is answered by intersecting the posting lists of the trigrams of the searched pattern.
+ *
+ * Names are folded (see fold()) before they are indexed; the folded names are stored in a column by their positions
+ * so that matching does not need to fold them again.  The column is kept in large blocks of memory which are never
+ * moved so the folded names stay valid while further names are added.
+ */
+class NameIndex {
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param isIgnoringDiacritics If true diacritical marks are removed from the folded names so that for example
+     * "bjork" matches "Björk".  Disabled by default to keep searching for letters with diacritics exact.
+     */
+    explicit NameIndex(bool isIgnoringDiacritics = false);
+
+    /**
+     * @brief Adds a name to the index.
+     *
+     * @param position Position identifying the name.  Each position shall be added at most once.
+     * @param name The name.
+     */
+    void add(int position, const std::string& name);
+
+    /**
+     * @brief Removes all names.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the folded name at the given position.
+     *
+     * @return The folded name or an empty string if no name was added at @p position.  Valid until clear() is called.
+     */
+    std::string_view getFoldedName(int position) const;
+
+    /**
+     * @brief Folds the given string so that it can be compared with the folded names.
+     *
+     * Letters are converted by Unicode case folding and the string is normalized to the composed form.  If the index
+     * ignores diacritics they are removed from the letters.  Strings which consist of ASCII characters only are folded
+     * directly without conversions.
+     *
+     * @param str UTF-8 encoded string.
+     * @return The folded string.
+     */
+    std::string fold(const std::string& str) const;
+
+    /**
+     * @brief Finds candidates of names that contain the given pattern.
+     *
+     * The candidates contain all trigrams of the pattern; it is not guaranteed they contain the pattern itself so they
+     * have to be verified by the caller.
+     *
+     * @param pattern The searched pattern; it shall be folded.
+     * @param candidates Filled by sorted positions of the candidates.
+     * @return false if the pattern is too short to be searched in the index; the caller has to check all names then.
+     */
+    bool findCandidates(const std::string& pattern, std::vector<int>& candidates) const;
+
+private:
+    // arguments from the constructor
+    const bool myIsIgnoringDiacritics;
+
+    // posting lists of trigrams
+    std::unordered_map<uint32_t, std::vector<int>> myPostingLists;
+
+    // folded names by their positions; they point to the name blocks
+    std::vector<std::string_view> myFoldedNames;
+
+    // storage of the folded names and its unused part at the end of the last block
+    std::vector<std::unique_ptr<char[]>> myNameBlocks;
+    char* myNameBlockFree = nullptr;
+    size_t myNameBlockFreeSize = 0;
+
+    std::string_view storeFoldedName(const std::string& foldedName);
+
+    static std::vector<uint32_t> createTrigrams(const std::string& str);
+};
+
+}
+
+
+
+#endif // NAMEINDEX_H
@@ -0,0 +1,68 @@
+// offset_bitmap.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef OFFSETBITMAP_H
+#define OFFSETBITMAP_H
+
+
+
+#include <cstdint>
+#include <vector>
+
+
+
+namespace data {
+
+/**
+ * @brief Set of non-negative offsets stored as a bitmap.
+ *
+ * Besides the bitmap of offsets a summary bitmap is kept where each bit tells whether a whole word of the offsets
+ * bitmap is set.  A query of a range of offsets therefore checks at most two words of the offsets bitmap and one bit
+ * of the summary per 64 words.
+ */
+class OffsetBitmap {
+
+public:
+    /**
+     * @brief Adds the given offsets.
+     *
+     * @param offset The first added offset.
+     * @param count The number of added offsets.
+     */
+    void set(int offset, int count = 1);
+
+    /**
+     * @brief Removes all offsets.
+     */
+    void clear();
+
+    /**
+     * @brief Returns true if all given offsets are in the set.
+     *
+     * @param offset The first checked offset.
+     * @param count The number of checked offsets.
+     */
+    bool contains(int offset, int count = 1) const;
+
+private:
+    // the offsets; bit of an offset is (offset % 64) in the word (offset / 64)
+    std::vector<uint64_t> myWords;
+
+    // bits of the words of myWords which are fully set; stored the same way as the offsets
+    std::vector<uint64_t> myFullWords;
+
+    static void setBits(std::vector<uint64_t>& words, int first, int last);
+    static bool areBitsSet(const std::vector<uint64_t>& words, int first, int last);
+};
+
+}
+
+
+
+#endif // OFFSETBITMAP_H
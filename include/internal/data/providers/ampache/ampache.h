@@ -20,7 +20,9 @@
 #include <chrono>
 
 #include <QObject>
+#include <QByteArray>
 #include <QPixmap>
+#include <QThreadPool>
 
 #include "infrastructure/event/event.h"
 #include "data/providers/connection_info.h"
@@ -35,6 +37,31 @@ namespace data {
 class AlbumData;
 class ArtistData;
 class TrackData;
+class IdInterner;
+
+
+
+/**
+ * @brief Data retrieved from the server by a single request.
+ */
+template <typename T>
+struct ReadyData {
+
+    /**
+     * @brief Offset of the first data item as requested.
+     */
+    int offset;
+
+    /**
+     * @brief The retrieved data items.
+     */
+    std::vector<std::unique_ptr<T>> data;
+
+    /**
+     * @brief true if an error occured.
+     */
+    bool error;
+};
 
 
 
@@ -57,15 +84,35 @@ public:
      */
     using NetworkRequestFn = std::function<void(const std::string& url, NetworkRequestCb& networkRequestCb)>;
 
+    /**
+     * @brief Kind of a change of server records.
+     */
+    enum class Change {
+        /**
+         * @brief Records added to the server.
+         */
+        Added,
+
+        /**
+         * @brief Records updated on the server.
+         */
+        Updated
+    };
+
     /**
      * @brief Constructor.
      *
      * @param connectionInfo Information used to connect to the Ampache server.
      * @param networkRequestFn Function that will be called to retrieve data from network.  Usage of this function
      *        is workaround for segfault on exit when QNetworkAccessManager is used together with Audacious.
+     * @param albumThumbnailSize Size to which album arts are scaled.
+     * @param artistIds Interner of IDs of artists which albums and tracks refer to.
+     * @param albumIds Interner of IDs of albums which tracks refer to.
      */
-    explicit Ampache(
-        const ConnectionInfo& connectionInfo, const NetworkRequestFn& networkRequestFn, int albumThumbnailSize);
+    explicit Ampache(const ConnectionInfo& connectionInfo, const NetworkRequestFn& networkRequestFn,
+        int albumThumbnailSize, IdInterner& artistIds, IdInterner& albumIds);
+
+    ~Ampache();
 
     Ampache(const Ampache& other) = delete;
 
@@ -85,21 +132,21 @@ public:
      *
      * @sa requestAlbums()
      */
-    infrastructure::Event<std::pair<std::vector<std::unique_ptr<AlbumData>>, bool>> readyAlbums{};
+    infrastructure::Event<ReadyData<AlbumData>> readyAlbums{};
 
     /**
      * @brief Event fired when some artists data has been retrieved from the server.
      *
      * @sa requestArtists()
      */
-    infrastructure::Event<std::pair<std::vector<std::unique_ptr<ArtistData>>, bool>> readyArtists{};
+    infrastructure::Event<ReadyData<ArtistData>> readyArtists{};
 
     /**
      * @brief Event fired when some tracks data has been retrieved from the server.
      *
      * @sa requesTracks()
      */
-    infrastructure::Event<std::pair<std::vector<std::unique_ptr<TrackData>>, bool>> readyTracks{};
+    infrastructure::Event<ReadyData<TrackData>> readyTracks{};
 
     /**
      * @brief Event fired when some album arts has been retrieved from the server.
@@ -142,6 +189,14 @@ public:
      */
     std::chrono::system_clock::time_point getLastUpdate() const;
 
+    /**
+     * @brief Gets time point of the latest database clean (removal of records) as reported by the server during
+     * handshake.
+     *
+     * @return Time point of the latest clean or std::chrono::system_clock::time_point::min() if it was not reported.
+     */
+    std::chrono::system_clock::time_point getLastClean() const;
+
     /**
      * @brief Gets the number of albums as reported by the server during handshake.
      *
@@ -180,6 +235,18 @@ public:
      */
     void requestAlbums(int offset, int limit);
 
+    /**
+     * @brief Request album records which were added or updated on the server after the given time point.
+     *
+     * @param offset Starting offset that shall be requested.
+     * @param limit Maximal number of records that shall be requested.
+     * @param change Whether added or updated records shall be requested.
+     * @param since Only records changed after this time point shall be requested.
+     *
+     * @sa ::readyAlbums
+     */
+    void requestAlbums(int offset, int limit, Change change, std::chrono::system_clock::time_point since);
+
     /**
      * @brief Request artist records from the server.
      *
@@ -190,6 +257,18 @@ public:
      */
     void requestArtists(int offset, int limit);
 
+    /**
+     * @brief Request artist records which were added or updated on the server after the given time point.
+     *
+     * @param offset Starting offset that shall be requested.
+     * @param limit Maximal number of records that shall be requested.
+     * @param change Whether added or updated records shall be requested.
+     * @param since Only records changed after this time point shall be requested.
+     *
+     * @sa ::readyArtists
+     */
+    void requestArtists(int offset, int limit, Change change, std::chrono::system_clock::time_point since);
+
     /**
      * @brief Request track records from the server.
      *
@@ -200,6 +279,18 @@ public:
      */
     void requestTracks(int offset, int limit);
 
+    /**
+     * @brief Request track records which were added or updated on the server after the given time point.
+     *
+     * @param offset Starting offset that shall be requested.
+     * @param limit Maximal number of records that shall be requested.
+     * @param change Whether added or updated records shall be requested.
+     * @param since Only records changed after this time point shall be requested.
+     *
+     * @sa ::readyTracks
+     */
+    void requestTracks(int offset, int limit, Change change, std::chrono::system_clock::time_point since);
+
     /**
      * @brief Request album arts from the server.
      *
@@ -235,6 +326,9 @@ public:
 
 private slots:
     void onScaleAlbumArtRunnableFinished(ScaleAlbumArtRunnable* scaleAlbumArtRunnable);
+    void onAlbumsParsingFinished();
+    void onArtistsParsingFinished();
+    void onTracksParsingFinished();
 
 private:
      // Ampache server method names
@@ -246,10 +340,32 @@ private:
         const std::string Tracks = "songs";
     } Method;
 
+    // elements of the server responses which are processed
+    enum class Element {
+        Other,
+        Root,
+        Error,
+        Album,
+        Artist,
+        Song,
+        Name,
+        Title,
+        Year,
+        Disk,
+        Tracks,
+        Track,
+        Albums,
+        Songs,
+        Art,
+        Url
+    };
+
     // arguments from the constructor
     const ConnectionInfo myConnectionInfo;
     const NetworkRequestFn myNetworkRequestFn;
     const int myAlbumThumbnailSize = 0;
+    IdInterner& myArtistIds;
+    IdInterner& myAlbumIds;
 
     // network communication callback functions
     NetworkRequestCb myNetworkRequestCb;
@@ -266,6 +382,7 @@ private:
 
     // basic properties as returned by the server during handshake
     std::chrono::system_clock::time_point myLastUpdate = std::chrono::system_clock::time_point::min();
+    std::chrono::system_clock::time_point myLastClean = std::chrono::system_clock::time_point::min();
     int myNumberOfAlbums = 0;
     int myNumberOfArtists = 0;
     int myNumberOfTracks = 0;
@@ -276,24 +393,41 @@ private:
     // map of [URL, album art] of album arts that were requested to load and the request was fulfilled
     std::map<std::string, QPixmap> myFinishedAlbumArts;
 
+    // threads parsing responses with data
+    QThreadPool myParsingThreadPool;
+
     void onNetworkRequestFinished(const std::string& url, const char* content, int contentSize);
     void onAlbumArtsNetworkRequestFinished(const std::string& artUrl, const char* content, int contentSize);
 
     void connectToServer();
     void callMethod(const std::string& name, const std::map<std::string, std::string>& arguments);
     bool isError(QXmlStreamReader& xmlStreamReader);
-    void dispatchToMethodHandler(const std::string& methodName, QXmlStreamReader& xmlStreamReader, bool error);
+    void dispatchToMethodHandler(const std::string& methodName, int offset, QXmlStreamReader& xmlStreamReader,
+        bool error);
     void processHandshake(QXmlStreamReader& xmlStreamReader, bool error);
     void processPing(QXmlStreamReader& xmlStreamReader, bool error, bool isRetry);
     void readHandshakeData(QXmlStreamReader& xmlStreamReader);
-    void processAlbums(QXmlStreamReader& xmlStreamReader, bool error);
-    std::vector<std::unique_ptr<AlbumData>> createAlbums(QXmlStreamReader& xmlStreamReader) const;
-    void processArtists(QXmlStreamReader& xmlStreamReader, bool error);
-    std::vector<std::unique_ptr<ArtistData>> createArtists(QXmlStreamReader& xmlStreamReader) const;
-    void processTracks(QXmlStreamReader& xmlStreamReader, bool error);
-    std::vector<std::unique_ptr<TrackData>> createTracks(QXmlStreamReader& xmlStreamReader) const;
+    void processAlbums(int offset, QXmlStreamReader& xmlStreamReader, bool error);
+    std::vector<std::unique_ptr<AlbumData>> createAlbums(QXmlStreamReader& xmlStreamReader, bool& error) const;
+    void processArtists(int offset, QXmlStreamReader& xmlStreamReader, bool error);
+    std::vector<std::unique_ptr<ArtistData>> createArtists(QXmlStreamReader& xmlStreamReader, bool& error) const;
+    void processTracks(int offset, QXmlStreamReader& xmlStreamReader, bool error);
+    std::vector<std::unique_ptr<TrackData>> createTracks(QXmlStreamReader& xmlStreamReader, bool& error) const;
+    template <typename S>
+    static Element toElement(const S& name);
+    static std::string readIdAttribute(QXmlStreamReader& xmlStreamReader);
+    template <typename S>
+    static std::string toStdString(const S& text);
+    template <typename T>
+    void startParsing(int offset, const QByteArray& content,
+        std::vector<std::unique_ptr<T>> (Ampache::*createFn)(QXmlStreamReader&, bool&) const,
+        const char* finishedSlot);
+    template <typename T>
+    void finishParsing(infrastructure::Event<ReadyData<T>>& readyEvent);
     void IfNoPendingClearFinishedAlbumArtsAndRaiseReady();
     std::string assembleUrlBase() const;
+    std::pair<std::string, std::string> createChangeArgument(Change change,
+        std::chrono::system_clock::time_point since) const;
 };
 
 }
@@ -12,8 +12,12 @@
 
 
 
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <functional>
 #include <memory>
 #include <chrono>
 #include <fstream>
@@ -31,6 +35,7 @@ namespace data {
 class ArtistData;
 class AlbumData;
 class TrackData;
+class IdInterner;
 
 
 
@@ -46,8 +51,11 @@ public:
      *
      * @param serverUrl URL of the Ampache server which data shall be cached.
      * @param user Ampache server user whose data shall be cached.
+     * @param artistIds Interner of IDs of artists which albums and tracks refer to.
+     * @param albumIds Interner of IDs of albums which tracks refer to.
      */
-    explicit Cache(const std::string& serverUrl, const std::string& user);
+    explicit Cache(const std::string& serverUrl, const std::string& user, IdInterner& artistIds,
+        IdInterner& albumIds);
 
     /**
      * @brief Event fired when some album arts has been retrieved from disk.
@@ -149,6 +157,24 @@ public:
      */
     void saveTracksData(std::vector<std::unique_ptr<TrackData>>& tracksData);
 
+    /**
+     * @brief Merge data changed on the server into the data stored on disk.
+     *
+     * Stored records with the same ID as a changed record are replaced by it, other changed records are appended.
+     * Cached arts of the changed albums are removed.  Finally the time point of the latest cache update is set to
+     * @p updateBegin.
+     *
+     * @param artistsData Artists data added or updated on the server.
+     * @param albumsData Albums data added or updated on the server.
+     * @param tracksData Tracks data added or updated on the server.
+     * @param updateBegin Time point when the changes started to be retrieved from the server.
+     *
+     * @sa getLastUpdate()
+     */
+    void mergeData(std::vector<std::unique_ptr<ArtistData>>& artistsData,
+        std::vector<std::unique_ptr<AlbumData>>& albumsData, std::vector<std::unique_ptr<TrackData>>& tracksData,
+        std::chrono::system_clock::time_point updateBegin);
+
     /**
      * @brief Store album arts to disk.
      *
@@ -160,8 +186,65 @@ private slots:
     void onArtsLoadFinished();
 
 private:
+    // reference to a string stored in the string pool of a data file
+    struct StringRef {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    // strings of a data file stored one after another; either backed by its own buffer (when saving) or by a memory
+    // mapped data file (when loading)
+    class StringPool {
+
+    public:
+        explicit StringPool(const char* data = nullptr, std::uint32_t size = 0);
+
+        StringRef add(const std::string& str);
+        std::string get(StringRef stringRef) const;
+        const char* data() const;
+        std::uint32_t size() const;
+
+    private:
+        std::string myBuffer;
+        const char* myData;
+        std::uint32_t mySize;
+    };
+
+    // data file layout: header, table of fixed width records, string pool
+    struct DataFileHeader {
+        std::uint32_t count;
+        std::uint32_t stringPoolSize;
+    };
+
+    struct ArtistRecord {
+        StringRef id;
+        std::int32_t numberOfAlbums;
+        std::int32_t numberOfTracks;
+        StringRef name;
+    };
+
+    struct AlbumRecord {
+        StringRef id;
+        StringRef artUrl;
+        StringRef artistId;
+        std::int32_t numberOfTracks;
+        StringRef name;
+        std::int32_t releaseYear;
+        std::int32_t mediaNumber;
+    };
+
+    struct TrackRecord {
+        StringRef id;
+        StringRef artistId;
+        StringRef albumId;
+        StringRef name;
+        StringRef disk;
+        std::int32_t number;
+        StringRef url;
+    };
+
     // cache format version
-    int const CACHE_VERSION = 1;
+    int const CACHE_VERSION = 2;
 
 #ifdef _WIN32
     // user cache directory
@@ -199,6 +282,10 @@ private:
     std::string myCurrentServerUrl = "";
     std::string myCurrentUser = "";
 
+    // arguments from the constructor
+    IdInterner& myArtistIds;
+    IdInterner& myAlbumIds;
+
     // server URL and user name of the cached data
     std::string myServerUrl = "";
     std::string myUser = "";
@@ -222,10 +309,24 @@ private:
     // identifiers of requested album arts which was not loaded yet
     std::vector<std::string> myRequestedAlbumArtIds;
 
+    int writeArtistsData(const std::vector<std::unique_ptr<ArtistData>>& artistsData) const;
+    int writeAlbumsData(const std::vector<std::unique_ptr<AlbumData>>& albumsData) const;
+    int writeTracksData(const std::vector<std::unique_ptr<TrackData>>& tracksData) const;
+    static StringRef addId(StringPool& pool, const IdInterner& ids, int idHandle,
+        std::unordered_map<int, StringRef>& pooledIds);
+    static int internId(const StringPool& pool, StringRef id, IdInterner& ids,
+        std::unordered_map<std::uint64_t, int>& idHandles);
+    template <typename T>
+    void mergeById(std::vector<std::unique_ptr<T>>& data, std::vector<std::unique_ptr<T>>& changedData) const;
     bool loadMeta(std::ifstream& metaStream);
     void saveMeta(std::chrono::system_clock::time_point lastUpdate);
     void invalidate();
     std::pair<std::string, QImage> loadAlbumArt(const std::string& id) const;
+    template <typename R>
+    void readDataFile(const std::string& path,
+        const std::function<void(const R& record, const StringPool& pool)>& processRecord) const;
+    template <typename R>
+    void writeDataFile(const std::string& path, const std::vector<R>& records, const StringPool& pool) const;
     std::string readString(std::ifstream& stream) const;
     void writeString(std::ofstream& stream, const std::string& str) const;
     void updateLastUpdateInfo();
@@ -29,6 +29,7 @@ class Ampache;
 class Cache;
 class ArtistRepository;
 class Indices;
+class IdInterner;
 
 
 
@@ -45,10 +46,11 @@ public:
      *
      * @param ampache Used for communication with Ampache server.
      * @param cache Used for accessing the disk cache.
-     * @param artistRepository Used to set artist of the album.
      * @param indices Indices to update.
+     * @param albumIds Interner of IDs of albums which tracks refer to.
+     * @param artistRepository Used to set artist of the album.
      */
-    explicit AlbumRepository(Ampache& ampache, Cache& cache, Indices& indices,
+    explicit AlbumRepository(Ampache& ampache, Cache& cache, Indices& indices, IdInterner& albumIds,
         const ArtistRepository* const artistRepository);
 
     ~AlbumRepository();
@@ -102,6 +104,14 @@ public:
      */
     AlbumData* getAlbumDataById(const std::string& id) const;
 
+    /**
+     * @brief Get album data with the given ID handle.
+     *
+     * @param idHandle Handle of the ID of the album data that shall be returned (see IdInterner::intern()).
+     * @return Album data with the given @p idHandle
+     */
+    AlbumData* getAlbumDataByIdHandle(int idHandle) const;
+
     /**
      * @brief Gets the load status of the given data items.
      *
@@ -143,7 +153,7 @@ protected:
 
     domain::Album& getDomainObject(const AlbumData& dataItem) const override;
 
-    infrastructure::Event<std::pair<std::vector<std::unique_ptr<AlbumData>>, bool>>& getDataLoadRequestFinishedEvent() override;
+    infrastructure::Event<ReadyData<AlbumData>>& getDataLoadRequestFinishedEvent() override;
 
     void loadDataFromCache() override;
 
@@ -23,6 +23,7 @@ namespace data {
 class Ampache;
 class Cache;
 class Indices;
+class IdInterner;
 
 
 
@@ -38,8 +39,9 @@ public:
      * @param ampache Used for communication with Ampache server.
      * @param cache Used for accessing the disk cache.
      * @param indices Indices to update.
+     * @param artistIds Interner of IDs of artists which albums and tracks refer to.
      */
-    explicit ArtistRepository(Ampache& ampache, Cache& cache, Indices& indices);
+    explicit ArtistRepository(Ampache& ampache, Cache& cache, Indices& indices, IdInterner& artistIds);
 
     ArtistRepository(const ArtistRepository& other) = delete;
 
@@ -52,7 +54,7 @@ protected:
 
     domain::Artist& getDomainObject(const ArtistData& dataItem) const override;
 
-    infrastructure::Event<std::pair<std::vector<std::unique_ptr<ArtistData>>, bool>>& getDataLoadRequestFinishedEvent() override;
+    infrastructure::Event<ReadyData<ArtistData>>& getDataLoadRequestFinishedEvent() override;
 
     void loadDataFromCache() override;
 
@@ -14,6 +14,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <unordered_map>
 #include <algorithm>
 
 #include "infrastructure/logging/logging.h"
@@ -26,6 +28,9 @@
 #include "data/filters/unfiltered_filter.h"
 #include "data/provider_type.h"
 #include "data/indices.h"
+#include "data/name_index.h"
+#include "data/id_interner.h"
+#include "data/offset_bitmap.h"
 
 
 
@@ -55,8 +60,10 @@ public:
      * @param ampache Used for communication with Ampache server.
      * @param cache Used for accessing the disk cache.
      * @param indices Indices that shall be updated.
+     * @param idInterner Interner of IDs of the data items.  If given the data items can be got by handles of their
+     *        IDs as well.
      */
-    explicit Repository(Ampache& ampache, Cache& cache, Indices& indices);
+    explicit Repository(Ampache& ampache, Cache& cache, Indices& indices, IdInterner* idInterner = nullptr);
 
     virtual ~Repository();
 
@@ -116,6 +123,8 @@ public:
     /**
      * @brief Trigger load of data from Ampache server or the cache.
      *
+     * Up to getLoadWindow() loads from the server can be in progress at once.  They may finish in any order.
+     *
      * @param offset Starting offset.
      * @param limit Maximal number of data items to load.
      * @return true if load was triggered, false otherwise.
@@ -124,6 +133,20 @@ public:
      */
     bool load(int offset, int limit);
 
+    /**
+     * @brief Sets the maximal number of loads from the server which can be in progress at once.
+     *
+     * @sa getLoadWindow(), load()
+     */
+    void setLoadWindow(int loadWindow);
+
+    /**
+     * @brief Gets the maximal number of loads from the server which can be in progress at once.
+     *
+     * @sa setLoadWindow(), load()
+     */
+    int getLoadWindow() const;
+
     /**
      * @brief Get a domain object of the data item at the given offset.
      *
@@ -141,6 +164,16 @@ public:
      */
     U* getById(const std::string& id) const;
 
+    /**
+     * @brief Get a domain object of the data item with the given ID handle.
+     *
+     * The repository has to be constructed with an ID interner.
+     *
+     * @param idHandle Handle of the ID of the data item (see IdInterner::intern()).
+     * @return The domain object of the data item with the given @p idHandle or nullptr if no such data item is loaded.
+     */
+    U* getByIdHandle(int idHandle) const;
+
     /**
      * @brief Gets the load status of the given data items.
      *
@@ -177,6 +210,26 @@ public:
      */
     virtual void disableLoading();
 
+    /**
+     * @brief Defers linking of loaded data items to data of other repositories.
+     *
+     * Allows to load data before the data they refer to are loaded.  Loaded data items are stored but neither
+     * handleLoadedItem() nor updateIndices() is called for them until linkDeferredData() is called.
+     *
+     * @sa linkDeferredData()
+     */
+    void deferLinking();
+
+    /**
+     * @brief Links data items loaded while linking was deferred and stops deferring.
+     *
+     * Should be called once the data the items refer to are fully loaded.  Fires ::dataSizeChanged if any data were
+     * linked so that consumers can refresh presentation of the linked items.
+     *
+     * @sa deferLinking()
+     */
+    void linkDeferredData();
+
     /**
      * @brief Sets a filter.
      *
@@ -202,12 +255,54 @@ public:
      */
     bool isFiltered() const;
 
+    /**
+     * @brief Gets changes of the filtered data since they were acknowledged and acknowledges the current ones.
+     *
+     * Allows consumers to refresh only the data items which were removed or inserted, for example when the filter
+     * was changed.  Many small changes are not reported; refreshing all data items is cheaper for consumers then.
+     *
+     * @param changes Filled by the changes (see Filter::getChangesSince()).
+     * @return false if the changes are not determined; all data items shall be refreshed by the consumer then.
+     *
+     * @sa acknowledgeFilteredData()
+     */
+    bool takeFilteredDataChanges(std::vector<FilteredDataChange>& changes);
+
+    /**
+     * @brief Acknowledges the current filtered data without getting their changes.
+     *
+     * Should be called when the consumer refreshed data items by other means, e. g. when they were loaded.
+     *
+     * @sa takeFilteredDataChanges()
+     */
+    void acknowledgeFilteredData();
+
+    /**
+     * @brief Gets the index of names of the loaded data items by their offsets.
+     *
+     * The index is updated as the data are loaded or read from the cache; it holds also the folded names.  It is
+     * intended for name filters of the repository.
+     */
+    const NameIndex& getNameIndex() const;
+
+    /**
+     * @brief Gets the stored data items by their offsets.
+     *
+     * Data items which are not loaded yet are null.
+     */
+    const std::vector<std::unique_ptr<T>>& getData() const;
+
 protected:
     /**
      * @brief The stored data.
      */
     std::vector<std::unique_ptr<T>> myData;
 
+    /**
+     * @brief Offsets of the loaded data items in ::myData.
+     */
+    OffsetBitmap myLoadedOffsets;
+
     /**
      * @brief Accesses the Ampache server.
      */
@@ -265,8 +360,7 @@ protected:
      *
      * @sa requestDataLoad
      */
-    virtual infrastructure::Event<std::pair<std::vector<std::unique_ptr<T>>, bool>>&
-        getDataLoadRequestFinishedEvent() = 0;
+    virtual infrastructure::Event<ReadyData<T>>& getDataLoadRequestFinishedEvent() = 0;
 
     /**
      * @brief Loads data from cache.
@@ -290,7 +384,9 @@ protected:
     virtual void handleLoadedItem(const T& dataItem) const;
 
     /**
-     * @brief Updates indices for the given @p dataItem.
+     * @brief Updates indices for the given @p data.
+     *
+     * Null items in @p data are skipped.
      *
      * @sa ::myIndices
      */
@@ -315,14 +411,36 @@ protected:
      */
     virtual void handleDataSizeChanged();
 
+    /**
+     * @brief Get the data item with the given ID.
+     *
+     * @param id The ID of the data item that shall be returned.
+     * @return The data item with the given @p id or nullptr if no such data item is loaded.
+     */
+    T* getDataById(const std::string& id) const;
+
+    /**
+     * @brief Get the data item with the given ID handle.
+     *
+     * @param idHandle Handle of the ID of the data item that shall be returned.
+     * @return The data item with the given @p idHandle or nullptr if no such data item is loaded.
+     */
+    T* getDataByIdHandle(int idHandle) const;
+
 private:
     // number of loaded data items so far
     int myLoadProgress = 0;
 
-    // starting offset and count of data items that are being currently loaded; myLoadOffset = -1 if no loading
-    // is in progress
-    int myLoadOffset = -1;
-    int myLimit;
+    // <starting offset, limit> map of loads that are currently in progress
+    std::map<int, int> myLoadRequests;
+
+    // <starting offset, number of requests> map of loads which were in progress when the repository was cleared; their
+    // responses are not valid anymore (e. g. due to a provider change)
+    std::map<int, int> myStaleLoadRequests;
+    int myNumberOfStaleLoadRequests = 0;
+
+    // maximal number of loads from the server in progress at once
+    int myLoadWindow = 4;
 
     // filter which is active when no filter is set
     std::shared_ptr<UnfilteredFilter<T>> myUnfilteredFilter = std::shared_ptr<UnfilteredFilter<T>>{
@@ -337,20 +455,50 @@ private:
     // number of data entries that were not able to be loaded
     int myNumberOfUnavailableEntries = 0;
 
+    // true if linking of loaded data items is deferred
+    bool myIsLinkingDeferred = false;
+
+    // <data item ID, offset in myData> map; updated as the data are loaded
+    std::unordered_map<std::string, int> myIdIndex;
+
+    // argument from the constructor
+    IdInterner* const myIdInterner;
+
+    // offsets in myData by handles of data item IDs (-1 if not loaded); used only with an ID interner
+    std::vector<int> myIdHandleIndex;
+
+    // names of data items by their offset in myData; updated as the data are loaded
+    NameIndex myNameIndex;
+
+    // filtered data as they were acknowledged by the consumer; the flag is false if they were not complete
+    FilteredDataSnapshot<T> myAcknowledgedFilteredData;
+    bool myIsFilteredDataAcknowledged = false;
+
     void onFilterChanged();
-    void onDataLoadRequestFinished(std::pair<std::vector<std::unique_ptr<T>>, bool>& dataAndError);
+    void onDataLoadRequestFinished(ReadyData<T>& readyData);
 
     void loadFromCache();
+    void updateIdIndex(int offset, int length);
+    void updateNameIndex(int offset, int length);
+    void updateLoadedOffsets(int offset, int length);
     int computeCount() const;
+    int getNumberOfPendingLoadRequests() const;
 };
 
 
 
+// maximal number of reported changes of filtered data; views refresh all data items faster than they process many
+// small changes
+static const unsigned int MAX_FILTERED_DATA_CHANGES = 100;
+
+
+
 template <typename T, typename U>
-Repository<T, U>::Repository(Ampache& ampache, Cache& cache, Indices& indices):
+Repository<T, U>::Repository(Ampache& ampache, Cache& cache, Indices& indices, IdInterner* idInterner):
 myAmpache(ampache),
 myCache(cache),
-myIndices(indices) {
+myIndices(indices),
+myIdInterner(idInterner) {
     myUnfilteredFilter->setSourceData(myData);
     myUnfilteredFilter->changed += infrastructure::DELEGATE0((&Repository<T, U>::onFilterChanged));
     myFilter = myUnfilteredFilter;
@@ -390,16 +538,18 @@ void Repository<T, U>::setProviderType(ProviderType providerType) {
  */
 template <typename T, typename U>
 bool Repository<T, U>::load(int offset, int limit) {
-    if (myLoadOffset != -1 || !myLoadingEnabled) {
+    if (static_cast<int>(myLoadRequests.size()) >= myLoadWindow || myLoadRequests.count(offset) != 0 ||
+        !myLoadingEnabled) {
         return false;
     }
 
     infrastructure::LOG_DBG("Load from %d, limit %d.", offset, limit);
     if (myProviderType == ProviderType::Ampache) {
-        myLoadOffset = offset;
-        myLimit = limit;
-        getDataLoadRequestFinishedEvent() += infrastructure::DELEGATE1(
-            (&Repository<T, U>::onDataLoadRequestFinished), std::pair<std::vector<std::unique_ptr<T>>, bool>);
+        if (getNumberOfPendingLoadRequests() == 0) {
+            getDataLoadRequestFinishedEvent() += infrastructure::DELEGATE1(
+                (&Repository<T, U>::onDataLoadRequestFinished), ReadyData<T>);
+        }
+        myLoadRequests[offset] = limit;
 
         requestDataLoad(offset, limit);
     } else if (myProviderType == ProviderType::Cache) {
@@ -415,6 +565,20 @@ bool Repository<T, U>::load(int offset, int limit) {
 
 
 
+template <typename T, typename U>
+void Repository<T, U>::setLoadWindow(int loadWindow) {
+    myLoadWindow = loadWindow;
+}
+
+
+
+template <typename T, typename U>
+int Repository<T, U>::getLoadWindow() const {
+    return myLoadWindow;
+}
+
+
+
 template <typename T, typename U>
 U& Repository<T, U>::get(int filteredOffset) const {
     T* data = myFilter->getFilteredData()[filteredOffset];
@@ -425,19 +589,29 @@ U& Repository<T, U>::get(int filteredOffset) const {
 
 template <typename T, typename U>
 U* Repository<T, U>::getById(const std::string& id) const {
-    auto dataIter = std::find_if(myData.begin(), myData.end(),
-        [&id](const std::unique_ptr<T>& d) {return d != nullptr && d->getId() == id;});
-    return dataIter != myData.end() ? &getDomainObject(*dataIter->get()) : nullptr;
+    auto data = getDataById(id);
+    return data != nullptr ? &getDomainObject(*data) : nullptr;
+}
+
+
+
+template <typename T, typename U>
+U* Repository<T, U>::getByIdHandle(int idHandle) const {
+    auto data = getDataByIdHandle(idHandle);
+    return data != nullptr ? &getDomainObject(*data) : nullptr;
 }
 
 
 
 template <typename T, typename U>
 bool Repository<T, U>::isLoaded(int filteredOffset, int count) const {
-    uint end = filteredOffset + count;
-    auto filteredData = myFilter->getFilteredData();
-    return (filteredData.size() >= end) && std::all_of(filteredData.begin() + filteredOffset,
-        filteredData.begin() + filteredOffset + count, [](const T* const fd) {return fd != nullptr;});
+
+    // filters provide loaded data items only; without a filter the filtered offsets are the same as offsets in myData
+    if (isFiltered()) {
+        return filteredOffset >= 0 && count >= 0 &&
+            filteredOffset + count <= static_cast<int>(myFilter->getFilteredData().size());
+    }
+    return myLoadedOffsets.contains(filteredOffset, count);
 }
 
 
@@ -463,7 +637,7 @@ template <typename T, typename U>
 void Repository<T, U>::disableLoading() {
     myLoadingEnabled = false;
     myCachedCount = -1;
-    if (myLoadOffset == -1)
+    if (getNumberOfPendingLoadRequests() == 0)
     {
         loadingDisabled();
     }
@@ -471,6 +645,35 @@ void Repository<T, U>::disableLoading() {
 
 
 
+template <typename T, typename U>
+void Repository<T, U>::deferLinking() {
+    myIsLinkingDeferred = true;
+}
+
+
+
+template <typename T, typename U>
+void Repository<T, U>::linkDeferredData() {
+    if (!myIsLinkingDeferred) {
+        return;
+    }
+
+    infrastructure::LOG_DBG("Linking %d deferred entries.", myLoadProgress);
+    myIsLinkingDeferred = false;
+    for (auto& dataItem: myData) {
+        if (dataItem != nullptr) {
+            handleLoadedItem(*dataItem);
+        }
+    }
+    updateIndices(myData);
+
+    if (myLoadProgress != 0) {
+        handleDataSizeChanged();
+    }
+}
+
+
+
 template <typename T, typename U>
 void Repository<T, U>::setFilter(std::unique_ptr<Filter<T>> filter) {
     infrastructure::LOG_DBG("Setting a filter.");
@@ -514,6 +717,48 @@ bool Repository<T, U>::isFiltered() const {
 
 
 
+template <typename T, typename U>
+bool Repository<T, U>::takeFilteredDataChanges(std::vector<FilteredDataChange>& changes) {
+    auto areChangesDetermined = myIsFilteredDataAcknowledged &&
+        static_cast<int>(myFilter->getFilteredData().size()) == count() &&
+        myFilter->getChangesSince(myAcknowledgedFilteredData, changes) && changes.size() <= MAX_FILTERED_DATA_CHANGES;
+    acknowledgeFilteredData();
+    return areChangesDetermined;
+}
+
+
+
+template <typename T, typename U>
+void Repository<T, U>::acknowledgeFilteredData() {
+
+    // without a filter the filtered data do not contain data items which are not loaded yet so they can not be
+    // compared with consumer's data items
+    // the snapshot of the unfiltered filter stores only its size; a copy of the filtered data is kept only while a
+    // filter is set
+    myIsFilteredDataAcknowledged = static_cast<int>(myFilter->getFilteredData().size()) == count();
+    if (myIsFilteredDataAcknowledged) {
+        myFilter->takeSnapshot(myAcknowledgedFilteredData);
+    } else {
+        myAcknowledgedFilteredData = FilteredDataSnapshot<T>{};
+    }
+}
+
+
+
+template <typename T, typename U>
+const NameIndex& Repository<T, U>::getNameIndex() const {
+    return myNameIndex;
+}
+
+
+
+template <typename T, typename U>
+const std::vector<std::unique_ptr<T>>& Repository<T, U>::getData() const {
+    return myData;
+}
+
+
+
 template <typename T, typename U>
 void Repository<T, U>::handleLoadedItem(const T&) const {
 }
@@ -524,11 +769,23 @@ template <typename T, typename U>
 void Repository<T, U>::clear() {
     infrastructure::LOG_DBG("Clearing.");
     myData.clear();
+    myLoadedOffsets.clear();
+    myIdIndex.clear();
+    myIdHandleIndex.clear();
+    myNameIndex.clear();
     myLoadProgress = 0;
-    myLoadOffset = -1;
+    for (auto& offsetAndLimit: myLoadRequests) {
+        myStaleLoadRequests[offsetAndLimit.first]++;
+        myNumberOfStaleLoadRequests++;
+    }
+    myLoadRequests.clear();
     myNumberOfUnavailableEntries = 0;
     myCachedCount = -1;
 
+    // the acknowledged filtered data are stored by offsets which refer to the removed data items now
+    myIsFilteredDataAcknowledged = false;
+    myAcknowledgedFilteredData = FilteredDataSnapshot<T>{};
+
     clearIndices();
     myUnfilteredFilter->processUpdatedSourceData();
     myFilter->processUpdatedSourceData();
@@ -544,6 +801,24 @@ void Repository<T, U>::handleDataSizeChanged() {
 
 
 
+template <typename T, typename U>
+T* Repository<T, U>::getDataById(const std::string& id) const {
+    auto idIndexIter = myIdIndex.find(id);
+    return idIndexIter != myIdIndex.end() ? myData[idIndexIter->second].get() : nullptr;
+}
+
+
+
+template <typename T, typename U>
+T* Repository<T, U>::getDataByIdHandle(int idHandle) const {
+    if (idHandle >= static_cast<int>(myIdHandleIndex.size()) || myIdHandleIndex[idHandle] == -1) {
+        return nullptr;
+    }
+    return myData[myIdHandleIndex[idHandle]].get();
+}
+
+
+
 template <typename T, typename U>
 void Repository<T, U>::onFilterChanged() {
     infrastructure::LOG_DBG("Processing filter changed event.");
@@ -553,22 +828,49 @@ void Repository<T, U>::onFilterChanged() {
 
 
 template <typename T, typename U>
-void Repository<T, U>::onDataLoadRequestFinished(std::pair<std::vector<std::unique_ptr<T>>, bool>& dataAndError) {
-    auto data = std::move(dataAndError.first);
-    infrastructure::LOG_DBG("Ready %d entries from offset %d.", data.size(), myLoadOffset);
-    getDataLoadRequestFinishedEvent() -= infrastructure::DELEGATE1((&Repository<T, U>::onDataLoadRequestFinished),
-        std::pair<std::vector<std::unique_ptr<T>>, bool>);
+void Repository<T, U>::onDataLoadRequestFinished(ReadyData<T>& readyData) {
+    auto data = std::move(readyData.data);
+    auto loadOffset = readyData.offset;
+    infrastructure::LOG_DBG("Ready %d entries from offset %d.", data.size(), loadOffset);
+
+    // responses can be matched to their requests only by the offset; requests sent before the last clear() were sent
+    // sooner so the response is attributed to them first
+    bool isStale = false;
+    int limit = 0;
+    auto staleLoadRequestsIter = myStaleLoadRequests.find(loadOffset);
+    auto loadRequestsIter = myLoadRequests.find(loadOffset);
+    if (staleLoadRequestsIter != myStaleLoadRequests.end()) {
+        isStale = true;
+        staleLoadRequestsIter->second--;
+        if (staleLoadRequestsIter->second == 0) {
+            myStaleLoadRequests.erase(staleLoadRequestsIter);
+        }
+        myNumberOfStaleLoadRequests--;
+    } else if (loadRequestsIter != myLoadRequests.end()) {
+        limit = loadRequestsIter->second;
+        myLoadRequests.erase(loadRequestsIter);
+    } else {
+        infrastructure::LOG_WARN("Ignoring %d entries from offset %d which were not requested.", data.size(),
+            loadOffset);
+        return;
+    }
+    if (getNumberOfPendingLoadRequests() == 0) {
+        getDataLoadRequestFinishedEvent() -= infrastructure::DELEGATE1(
+            (&Repository<T, U>::onDataLoadRequestFinished), ReadyData<T>);
+    }
 
     if (!myLoadingEnabled)
     {
-        loadingDisabled();
+        if (getNumberOfPendingLoadRequests() == 0) {
+            loadingDisabled();
+        }
         return;
     }
 
     bool error = false;
 
     // return an empty result if the loaded data are not valid anymore (e. g. due to a provider change)
-    if (myLoadOffset == -1) {
+    if (isStale) {
 
         // fire loaded event to give a chance to consumers to continue their processing; even in the case of provider
         // change it might not be necessary since consumers should react on providerChanged event by cancelling
@@ -579,18 +881,49 @@ void Repository<T, U>::onDataLoadRequestFinished(std::pair<std::vector<std::uniq
         return;
     }
 
-    if (dataAndError.second) {
+    if (readyData.error) {
         error = true;
         fullyLoaded(error);
         return;
     }
 
-    for (auto& dataItem: data) {
-        handleLoadedItem(*dataItem);
+    // if the server returns more entries than requested, we assume that it ignores 'limit' in the load request; the
+    // entries above the limit belong to other loads so they are dropped; entries which are loaded already are never
+    // replaced since other objects (indices, filters, linked data items) refer to them
+    if (data.size() > static_cast<unsigned int>(limit)) {
+        infrastructure::LOG_WARN(
+            "Server does not respect 'limit' parameter. Performance during loading may be degraded.");
+        data.resize(limit);
+    }
+    // <offset, length> ranges of the entries which are not loaded yet
+    std::vector<std::pair<int, int>> newRanges;
+    int numberOfNewEntries = 0;
+    for (int idx = 0; idx < static_cast<int>(data.size()); idx++) {
+        auto entryOffset = loadOffset + idx;
+        if (myLoadedOffsets.contains(entryOffset)) {
+            data[idx].reset();
+        } else if (data[idx] != nullptr) {
+            if (!newRanges.empty() && newRanges.back().first + newRanges.back().second == entryOffset) {
+                newRanges.back().second++;
+            } else {
+                newRanges.emplace_back(entryOffset, 1);
+            }
+            numberOfNewEntries++;
+        }
+    }
+
+    if (!myIsLinkingDeferred) {
+        for (auto& dataItem: data) {
+            if (dataItem != nullptr) {
+                handleLoadedItem(*dataItem);
+            }
+        }
+        updateIndices(data);
     }
-    updateIndices(data);
 
-    uint offset = myLoadOffset;
+    // loads may finish in a different order than they were triggered so the data are placed according to the offset
+    // of their own load
+    uint offset = loadOffset;
     if (data.size() > 0) {
         auto end = offset + data.size();
         if (end > myData.size()) {
@@ -598,32 +931,35 @@ void Repository<T, U>::onDataLoadRequestFinished(std::pair<std::vector<std::uniq
         }
     }
     for (auto& dataItem: data) {
-        myData[offset] = std::move(dataItem);
+        if (dataItem != nullptr) {
+            myData[offset] = std::move(dataItem);
+        }
         offset++;
     }
+    for (auto& newRange: newRanges) {
+        updateIdIndex(newRange.first, newRange.second);
+        updateNameIndex(newRange.first, newRange.second);
+        updateLoadedOffsets(newRange.first, newRange.second);
+    }
 
     // if the server returns less entries than requested, we assume the missing ones are lost (theoretically they
     // could be deleted sooner than we were able to load them); in that case we store the number of lost entries and
-    // inform that total number of entries has changed; however if happens that the server returns more entries than
-    // requested, we assume that the server ignores 'limit' in the load request and work with returned entries as if
-    // they were requested
-    if (data.size() < static_cast<unsigned int>(myLimit)) {
-        myNumberOfUnavailableEntries += myLimit - data.size();
+    // inform that total number of entries has changed
+    if (data.size() < static_cast<unsigned int>(limit)) {
+        myNumberOfUnavailableEntries += limit - data.size();
         handleDataSizeChanged();
-    } else if (data.size() > static_cast<unsigned int>(myLimit)) {
-        infrastructure::LOG_WARN(
-            "Server does not respect 'limit' parameter. Performance during loading may be degraded.");
     }
 
-    myUnfilteredFilter->processUpdatedSourceData(myLoadOffset, data.size());
-    if (isFiltered()) {
-        myFilter->processUpdatedSourceData(myLoadOffset, data.size());
+    for (auto& newRange: newRanges) {
+        myUnfilteredFilter->processUpdatedSourceData(newRange.first, newRange.second);
+        if (isFiltered()) {
+            myFilter->processUpdatedSourceData(newRange.first, newRange.second);
+        }
     }
 
-    auto offsetAndLimit = std::pair<int, int>{myLoadOffset, data.size()};
+    auto offsetAndLimit = std::pair<int, int>{loadOffset, data.size()};
 
-    myLoadOffset = -1;
-    myLoadProgress += data.size();
+    myLoadProgress += numberOfNewEntries;
     infrastructure::LOG_DBG("Load progress: %d.", myLoadProgress);
 
     bool isFullyLoaded = myLoadProgress >= maxCount();
@@ -642,15 +978,20 @@ void Repository<T, U>::onDataLoadRequestFinished(std::pair<std::vector<std::uniq
 template <typename T, typename U>
 void Repository<T, U>::loadFromCache() {
     loadDataFromCache();
-
-    for (auto& data: myData) {
-        handleLoadedItem(*data);
+    updateIdIndex(0, myData.size());
+    updateNameIndex(0, myData.size());
+    myLoadedOffsets.clear();
+    updateLoadedOffsets(0, myData.size());
+
+    if (!myIsLinkingDeferred) {
+        for (auto& data: myData) {
+            handleLoadedItem(*data);
+        }
+        updateIndices(myData);
     }
-    updateIndices(myData);
 
     myUnfilteredFilter->processUpdatedSourceData();
     myFilter->processUpdatedSourceData();
-    myLoadOffset = -1;
     myLoadProgress += myData.size();
 
     auto offsetAndLimit = std::pair<int, int>{0, myData.size()};
@@ -661,6 +1002,48 @@ void Repository<T, U>::loadFromCache() {
 
 
 
+template <typename T, typename U>
+void Repository<T, U>::updateIdIndex(int offset, int length) {
+    for (auto idx = offset; idx < offset + length; idx++) {
+        auto& dataItem = myData[idx];
+        if (dataItem != nullptr) {
+            myIdIndex.emplace(dataItem->getId(), idx);
+            if (myIdInterner != nullptr) {
+                auto idHandle = myIdInterner->intern(dataItem->getId());
+                if (idHandle >= static_cast<int>(myIdHandleIndex.size())) {
+                    myIdHandleIndex.resize(idHandle + 1, -1);
+                }
+                myIdHandleIndex[idHandle] = idx;
+            }
+        }
+    }
+}
+
+
+
+template <typename T, typename U>
+void Repository<T, U>::updateNameIndex(int offset, int length) {
+    for (auto idx = offset; idx < offset + length; idx++) {
+        auto& dataItem = myData[idx];
+        if (dataItem != nullptr) {
+            myNameIndex.add(idx, getDomainObject(*dataItem).getName());
+        }
+    }
+}
+
+
+
+template <typename T, typename U>
+void Repository<T, U>::updateLoadedOffsets(int offset, int length) {
+    for (auto idx = offset; idx < offset + length; idx++) {
+        if (myData[idx] != nullptr) {
+            myLoadedOffsets.set(idx);
+        }
+    }
+}
+
+
+
 template <typename T, typename U>
 int Repository<T, U>::computeCount() const {
     if (isFiltered() && myLoadProgress != 0) {
@@ -669,6 +1052,13 @@ int Repository<T, U>::computeCount() const {
     return maxCount();
 }
 
+
+
+template <typename T, typename U>
+int Repository<T, U>::getNumberOfPendingLoadRequests() const {
+    return myLoadRequests.size() + myNumberOfStaleLoadRequests;
+}
+
 }
 
 
@@ -49,12 +49,12 @@ public:
     /**
      * @brief Gets the identifier.
      */
-    const std::string getId() const;
+    const std::string& getId() const;
 
     /**
      * @brief Gets album's name/title.
      */
-    const std::string getName() const;
+    const std::string& getName() const;
 
     /**
      * @brief Gets year of the album's release.
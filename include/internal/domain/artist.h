@@ -39,12 +39,12 @@ public:
     /**
      * @brief Gets the identifier.
      */
-    const std::string getId() const;
+    const std::string& getId() const;
 
     /**
      * @brief Gets artist's name.
      */
-    const std::string getName() const;
+    const std::string& getName() const;
 
 private:
     // arguments from the constructor
@@ -50,12 +50,12 @@ public:
     /**
      * @brief Gets the identifier.
      */
-    const std::string getId() const;
+    const std::string& getId() const;
 
     /**
      * @brief Gets track's name/title.
      */
-    const std::string getName() const;
+    const std::string& getName() const;
 
     /**
      * @brief Gets the Designation (usually a number) of a disk on which the track is present.
@@ -65,7 +65,7 @@ public:
      *
      * @sa getNumber(), getAlbum()
      */
-    const std::string getDisk() const;
+    const std::string& getDisk() const;
 
     /**
      * @brief Gets the number under which the track is listed on the album.
@@ -77,7 +77,7 @@ public:
     /**
      * @brief Gets URL to media file with recording of the track.
      */
-    const std::string getUrl() const;
+    const std::string& getUrl() const;
 
     /**
      * @brief Gets track's artist.
@@ -0,0 +1,60 @@
+// case_insensitive_search.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef CASEINSENSITIVESEARCH_H
+#define CASEINSENSITIVESEARCH_H
+
+
+
+#include <string>
+#include <string_view>
+
+
+
+namespace infrastructure {
+
+/**
+ * @brief Searches for a pattern in UTF-8 strings ignoring case of ASCII letters.
+ *
+ * Other characters, including multibyte UTF-8 sequences, have to match exactly.  This is the same as comparing
+ * characters converted by std::toupper() in the "C" locale.
+ *
+ * Strings are scanned by SSE2 or AVX2 instructions if the processor supports them; the implementation is selected at
+ * runtime.
+ */
+class CaseInsensitiveSearch {
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param pattern The pattern that shall be searched for.
+     */
+    explicit CaseInsensitiveSearch(const std::string& pattern);
+
+    /**
+     * @brief Checks whether the given string contains the pattern.
+     *
+     * An empty pattern is found in any non-empty string.
+     *
+     * @param str The string that shall be searched.
+     * @return true if the pattern was found in @p str.
+     */
+    bool isFoundIn(std::string_view str) const;
+
+private:
+    // the pattern with upper case ASCII letters
+    std::string myFoldedPattern;
+};
+
+}
+
+
+
+#endif // CASEINSENSITIVESEARCH_H
@@ -22,6 +22,7 @@
 
 class QAbstractItemModel;
 class QItemSelection;
+class QTimer;
 
 
 
@@ -69,6 +70,8 @@ public:
 
     /**
      * @brief Event fired after user triggered search function.
+     *
+     * While the search text is being typed it is fired after a short delay once the typing pauses.
      */
     infrastructure::Event<std::string> searchTriggered{};
 
@@ -138,12 +141,18 @@ private slots:
     void onTracksSelectionModelSelectionChanged(const QItemSelection& selected, const QItemSelection& deselected);
     void onSearchTextChanged(const QString& text);
     void onSearchReturnPressed();
+    void onSearchTimerTimeout();
     void onSettingsAccepted();
 
 private:
     // the main window widget
     AmpacheBrowserMainWindow* myMainWindow;
 
+    // delays search while the search text is being typed
+    QTimer* mySearchTimer;
+
+    void triggerSearch();
+
     void enableOrDisablePlayActions();
     SelectedItems getSelectedItems() const;
     QModelIndexList getAristSelectedRows() const;
@@ -20,8 +20,10 @@
 #include "infrastructure/logging/logging.h"
 #include "infrastructure/i18n.h"
 #include "data/providers/connection_info.h"
+#include "../data/data_objects/album_data.h"
 #include "data/providers/ampache/ampache.h"
 #include "data/providers/cache.h"
+#include "data/id_interner.h"
 #include "data/indices.h"
 #include "data/repositories/album_repository.h"
 #include "data/repositories/artist_repository.h"
@@ -49,7 +51,9 @@ using namespace ui;
 namespace application {
 
 AmpacheBrowserApp::AmpacheBrowserApp(SettingsInternal& settingsInternal):
-mySettingsInternal(settingsInternal) {
+mySettingsInternal(settingsInternal),
+myArtistIds{new IdInterner{{AlbumData::NO_ARTIST_ID}}},
+myAlbumIds{new IdInterner{}} {
 }
 
 
@@ -240,9 +244,9 @@ void AmpacheBrowserApp::initializeAndLoad() {
             static_cast<unsigned short>(mySettingsInternal.getInt(Settings::PROXY_PORT)),
             mySettingsInternal.getString(Settings::PROXY_USER), mySettingsInternal.getString(Settings::PROXY_PASSWORD)},
         myNetworkRequestFn,
-        myUi->getAlbumThumbnailSize()}};
-    myCache = std::unique_ptr<Cache>{new Cache{serverUrl, userName}};
-    myIndices = std::unique_ptr<Indices>{new Indices{}};
+        myUi->getAlbumThumbnailSize(), *myArtistIds, *myAlbumIds}};
+    myCache = std::unique_ptr<Cache>{new Cache{serverUrl, userName, *myArtistIds, *myAlbumIds}};
+    myIndices = std::unique_ptr<Indices>{new Indices{*myArtistIds, *myAlbumIds}};
 
     initializeDependencies();
 
@@ -253,9 +257,10 @@ void AmpacheBrowserApp::initializeAndLoad() {
 
 
 void AmpacheBrowserApp::initializeDependencies() {
-    myArtistRepository = std::unique_ptr<ArtistRepository>{new ArtistRepository{*myAmpache, *myCache, *myIndices}};
+    myArtistRepository = std::unique_ptr<ArtistRepository>{new ArtistRepository{*myAmpache, *myCache, *myIndices,
+        *myArtistIds}};
     myAlbumRepository = std::unique_ptr<AlbumRepository>{new AlbumRepository{*myAmpache, *myCache, *myIndices,
-        myArtistRepository.get()}};
+        *myAlbumIds, myArtistRepository.get()}};
     myTrackRepository = std::unique_ptr<TrackRepository>{new TrackRepository{*myAmpache, *myCache, *myIndices,
         myArtistRepository.get(), myAlbumRepository.get()}};
 
@@ -270,7 +275,7 @@ void AmpacheBrowserApp::initializeDependencies() {
     myFiltering = std::unique_ptr<Filtering>{new Filtering{*myUi, *myArtistRepository, *myAlbumRepository,
       *myTrackRepository, *myIndices}};
     myDataLoader = std::unique_ptr<DataLoader>{new DataLoader{myArtistRepository.get(), myAlbumRepository.get(),
-        myTrackRepository.get(), *myAmpache, *myCache}};
+        myTrackRepository.get(), *myAmpache, *myCache, *myArtistIds, *myAlbumIds}};
 
     myUi->playTriggered += DELEGATE1(&AmpacheBrowserApp::onPlayTriggered, SelectedItems);
     myUi->createPlaylistTriggered += DELEGATE1(&AmpacheBrowserApp::onCreatePlaylistTriggered, SelectedItems);
@@ -12,8 +12,12 @@
 #include "infrastructure/event/delegate.h"
 #include "infrastructure/logging/logging.h"
 #include "data/provider_type.h"
+#include "../data/data_objects/artist_data.h"
+#include "../data/data_objects/album_data.h"
+#include "../data/data_objects/track_data.h"
 #include "data/providers/ampache/ampache.h"
 #include "data/providers/cache.h"
+#include "data/id_interner.h"
 #include "data/repositories/artist_repository.h"
 #include "data/repositories/album_repository.h"
 #include "data/repositories/track_repository.h"
@@ -26,17 +30,36 @@ using namespace data;
 
 namespace application {
 
+// number of changed records requested from the server at once during the cache update
+static const int CACHE_UPDATE_LIMIT = 5000;
+
+// number of cache update steps; each kind of data is requested as added and as updated
+static const int CACHE_UPDATE_STEPS = 6;
+
+// the time of the cache update is taken from the local clock which may be behind the clock of the server; records
+// changed within this margin before the update are requested again next time (merging them is idempotent)
+static const std::chrono::minutes CACHE_UPDATE_CLOCK_MARGIN{60};
+
+
+
 DataLoader::DataLoader(ArtistRepository* const artistRepository, AlbumRepository* const albumRepository,
-TrackRepository* const trackRepository, Ampache& ampache, Cache& cache):
+TrackRepository* const trackRepository, Ampache& ampache, Cache& cache, IdInterner& artistIds,
+IdInterner& albumIds):
 myArtistRepository(artistRepository),
 myAlbumRepository(albumRepository),
 myTrackRepository(trackRepository),
 myAmpache(ampache),
-myCache(cache) {
+myCache(cache),
+myArtistIds(artistIds),
+myAlbumIds(albumIds) {
 }
 
 
 
+DataLoader::~DataLoader() = default;
+
+
+
 bool DataLoader::isLoadingInProgress() const {
     return myState == Loading;
 }
@@ -53,6 +76,7 @@ void DataLoader::load() {
     myIsConnectionSuccessful = false;
 
     myAmpacheInitializationFinished = false;
+    myCacheUpdateFinished = false;
     myArtistsLoadingFinished = false;
     myAlbumsLoadingFinished = false;
     myAlbumArtsLoadingFinished = false;
@@ -62,6 +86,10 @@ void DataLoader::load() {
     myAlbumRepository->setProviderType(ProviderType::None);
     myArtistRepository->setProviderType(ProviderType::None);
 
+    // no data refer to the interned IDs anymore; IDs of the previous data would only occupy the memory
+    myArtistIds.clear();
+    myAlbumIds.clear();
+
     myAmpache.initialized += DELEGATE1(&DataLoader::onAmpacheInitialized, bool);
     myAmpache.initialize();
 }
@@ -100,6 +128,7 @@ void DataLoader::onAmpacheInitialized(bool error) {
 
     myIsConnectionSuccessful = !error;
     if (myState == Aborting) {
+        myCacheUpdateFinished = true;
         possiblyFireFinishedOrAborted();
         return;
     }
@@ -112,18 +141,51 @@ void DataLoader::onAmpacheInitialized(bool error) {
     }
 
     if (error || (myCache.getServerUrl() == myAmpache.getUrl() && myCache.getUser() == myAmpache.getUser() &&
-            myCache.getLastUpdate() > myAmpache.getLastUpdate())) {
+            myCache.getLastUpdate() > myAmpache.getLastUpdate() &&
+            myCache.getLastUpdate() >= myAmpache.getLastClean())) {
         LOG_DBG("Setting data provider type to Cache (artists: %d, albums: %d, tracks: %d).",
             myCache.numberOfArtists(), myCache.numberOfAlbums(), myCache.numberOfTracks());
         myProviderType = ProviderType::Cache;
+    } else if (myCache.getServerUrl() == myAmpache.getUrl() && myCache.getUser() == myAmpache.getUser() &&
+            myCache.getLastUpdate() != std::chrono::system_clock::time_point::min() &&
+            myAmpache.getLastClean() <= myCache.getLastUpdate()) {
+
+        // records removed by a clean are not reported as changes so the cache is updated only if there was no clean
+        // since its last update
+        beginCacheUpdate();
+        return;
     } else {
         LOG_DBG("Setting data provider type to Ampache (artists: %d, albums: %d, tracks: %d).",
             myAmpache.numberOfArtists(), myAmpache.numberOfAlbums(), myAmpache.numberOfTracks());
         myProviderType = ProviderType::Ampache;
     }
 
-    myArtistRepository->fullyLoaded += DELEGATE1(&DataLoader::onArtistsFullyLoaded, bool);
-    myArtistRepository->setProviderType(myProviderType);
+    myCacheUpdateFinished = true;
+    startLoading();
+}
+
+
+
+void DataLoader::onChangedArtistsReady(ReadyData<ArtistData>& artistsData) {
+    if (processChangedData(artistsData, myChangedArtistsData)) {
+        requestChangedData();
+    }
+}
+
+
+
+void DataLoader::onChangedAlbumsReady(ReadyData<AlbumData>& albumsData) {
+    if (processChangedData(albumsData, myChangedAlbumsData)) {
+        requestChangedData();
+    }
+}
+
+
+
+void DataLoader::onChangedTracksReady(ReadyData<TrackData>& tracksData) {
+    if (processChangedData(tracksData, myChangedTracksData)) {
+        requestChangedData();
+    }
 }
 
 
@@ -132,14 +194,13 @@ void DataLoader::onArtistsFullyLoaded(bool error) {
     LOG_INF("Artists fully loaded with result %d.", error);
     myArtistRepository->fullyLoaded -= DELEGATE1(&DataLoader::onArtistsFullyLoaded, bool);
     myArtistsLoadingFinished = true;
+    linkLoadedData();
     if (error) {
         fireFinished(LoadingResult::Error);
         return;
     }
 
-    myAlbumRepository->fullyLoaded += DELEGATE1(&DataLoader::onAlbumsFullyLoaded, bool);
-    myAlbumRepository->artsFullyLoaded += DELEGATE1(&DataLoader::onArtsFullyLoaded, bool);
-    myAlbumRepository->setProviderType(myProviderType);
+    possiblyFireFinishedOrAborted();
 }
 
 
@@ -148,13 +209,13 @@ void DataLoader::onAlbumsFullyLoaded(bool error) {
     LOG_INF("Albums fully loaded with result %d.", error);
     myAlbumRepository->fullyLoaded -= DELEGATE1(&DataLoader::onAlbumsFullyLoaded, bool);
     myAlbumsLoadingFinished = true;
+    linkLoadedData();
     if (error) {
         fireFinished(LoadingResult::Error);
         return;
     }
 
-    myTrackRepository->fullyLoaded += DELEGATE1(&DataLoader::onTracksFullyLoaded, bool);
-    myTrackRepository->setProviderType(myProviderType);
+    possiblyFireFinishedOrAborted();
 }
 
 
@@ -190,6 +251,7 @@ void DataLoader::onArtsFullyLoaded(bool error) {
 void DataLoader::onArtistRepositoryLoadingDisabled() {
     LOG_INF("Artists loading disabled.");
     myArtistsLoadingFinished = true;
+    linkLoadedData();
     possiblyFireFinishedOrAborted();
 }
 
@@ -198,6 +260,7 @@ void DataLoader::onArtistRepositoryLoadingDisabled() {
 void DataLoader::onAlbumRepositoryLoadingDisabled() {
     LOG_INF("Albums loading disabled.");
     myAlbumsLoadingFinished = true;
+    linkLoadedData();
     possiblyFireFinishedOrAborted();
 }
 
@@ -219,9 +282,146 @@ void DataLoader::onTrackRepositoryLoadingDisabled() {
 
 
 
+void DataLoader::beginCacheUpdate() {
+    LOG_INF("Begin updating of the cache.");
+    myCacheUpdateBegin = std::chrono::system_clock::now() - CACHE_UPDATE_CLOCK_MARGIN;
+    myCacheUpdateStep = 0;
+    myCacheUpdateOffset = 0;
+
+    myAmpache.readyArtists += DELEGATE1(&DataLoader::onChangedArtistsReady, ReadyData<ArtistData>);
+    myAmpache.readyAlbums += DELEGATE1(&DataLoader::onChangedAlbumsReady, ReadyData<AlbumData>);
+    myAmpache.readyTracks += DELEGATE1(&DataLoader::onChangedTracksReady, ReadyData<TrackData>);
+
+    requestChangedData();
+}
+
+
+
+void DataLoader::requestChangedData() {
+    if (myCacheUpdateStep == CACHE_UPDATE_STEPS) {
+        finishCacheUpdate(false);
+        return;
+    }
+
+    auto since = myCache.getLastUpdate();
+    auto change = myCacheUpdateStep % 2 == 0 ? Ampache::Change::Added : Ampache::Change::Updated;
+    switch (myCacheUpdateStep / 2) {
+        case 0:
+            myAmpache.requestArtists(myCacheUpdateOffset, CACHE_UPDATE_LIMIT, change, since);
+            break;
+        case 1:
+            myAmpache.requestAlbums(myCacheUpdateOffset, CACHE_UPDATE_LIMIT, change, since);
+            break;
+        default:
+            myAmpache.requestTracks(myCacheUpdateOffset, CACHE_UPDATE_LIMIT, change, since);
+    }
+}
+
+
+
+template <typename T>
+bool DataLoader::processChangedData(ReadyData<T>& changedData, std::vector<std::unique_ptr<T>>& accumulatedData) {
+
+    if (myState == Aborting || changedData.error) {
+        finishCacheUpdate(true);
+        return false;
+    }
+
+    auto& data = changedData.data;
+    for (auto& dataItem: data) {
+        accumulatedData.push_back(std::move(dataItem));
+    }
+
+    // a page shorter than the limit is the last one of the current step
+    if (data.size() < static_cast<unsigned int>(CACHE_UPDATE_LIMIT)) {
+        myCacheUpdateStep++;
+        myCacheUpdateOffset = 0;
+    } else {
+        myCacheUpdateOffset += data.size();
+    }
+    return true;
+}
+
+
+
+void DataLoader::finishCacheUpdate(bool error) {
+    myAmpache.readyTracks -= DELEGATE1(&DataLoader::onChangedTracksReady, ReadyData<TrackData>);
+    myAmpache.readyAlbums -= DELEGATE1(&DataLoader::onChangedAlbumsReady, ReadyData<AlbumData>);
+    myAmpache.readyArtists -= DELEGATE1(&DataLoader::onChangedArtistsReady, ReadyData<ArtistData>);
+    myCacheUpdateFinished = true;
+
+    if (myState == Aborting) {
+        LOG_INF("Cache update aborted.");
+        myChangedArtistsData.clear();
+        myChangedAlbumsData.clear();
+        myChangedTracksData.clear();
+        possiblyFireFinishedOrAborted();
+        return;
+    }
+
+    if (error) {
+        LOG_WARN("Cache update failed; reloading all data.");
+        myProviderType = ProviderType::Ampache;
+    } else {
+        LOG_INF("Cache update finished (changed artists: %d, albums: %d, tracks: %d).", myChangedArtistsData.size(),
+            myChangedAlbumsData.size(), myChangedTracksData.size());
+        myCache.mergeData(myChangedArtistsData, myChangedAlbumsData, myChangedTracksData, myCacheUpdateBegin);
+
+        // records deleted on the server are not reported as changes; reload everything if the numbers do not match
+        if (myCache.numberOfArtists() == myAmpache.numberOfArtists() &&
+            myCache.numberOfAlbums() == myAmpache.numberOfAlbums() &&
+            myCache.numberOfTracks() == myAmpache.numberOfTracks()) {
+            myProviderType = ProviderType::Cache;
+        } else {
+            LOG_INF("Number of cached records differs from the server; reloading all data.");
+            myProviderType = ProviderType::Ampache;
+        }
+    }
+    myChangedArtistsData.clear();
+    myChangedAlbumsData.clear();
+    myChangedTracksData.clear();
+
+    LOG_DBG("Setting data provider type to %d.", static_cast<int>(myProviderType));
+    startLoading();
+}
+
+
+
+void DataLoader::startLoading() {
+
+    // all data are loaded at once; albums and tracks are linked to the data they refer to once those are fully loaded
+    myAlbumRepository->deferLinking();
+    myTrackRepository->deferLinking();
+
+    myArtistRepository->fullyLoaded += DELEGATE1(&DataLoader::onArtistsFullyLoaded, bool);
+    myAlbumRepository->fullyLoaded += DELEGATE1(&DataLoader::onAlbumsFullyLoaded, bool);
+    myAlbumRepository->artsFullyLoaded += DELEGATE1(&DataLoader::onArtsFullyLoaded, bool);
+    myTrackRepository->fullyLoaded += DELEGATE1(&DataLoader::onTracksFullyLoaded, bool);
+
+    myArtistRepository->setProviderType(myProviderType);
+    myAlbumRepository->setProviderType(myProviderType);
+    myTrackRepository->setProviderType(myProviderType);
+}
+
+
+
+void DataLoader::linkLoadedData() {
+
+    // data which were loaded are linked even if the loading failed or was aborted so that they are consistent
+    if (myArtistsLoadingFinished) {
+        myAlbumRepository->linkDeferredData();
+        if (myAlbumsLoadingFinished) {
+            myTrackRepository->linkDeferredData();
+        }
+    }
+}
+
+
+
 void DataLoader::possiblyFireFinishedOrAborted() {
-    if (myAmpacheInitializationFinished && myArtistsLoadingFinished && myAlbumsLoadingFinished &&
-        myAlbumArtsLoadingFinished && myTracksLoadingFinished) {
+    if (myAmpacheInitializationFinished && myCacheUpdateFinished && myArtistsLoadingFinished &&
+        myAlbumsLoadingFinished && myAlbumArtsLoadingFinished && myTracksLoadingFinished) {
+
         if (myState == Aborting) {
             myTrackRepository->loadingDisabled -= DELEGATE0(&DataLoader::onTrackRepositoryLoadingDisabled);
             myAlbumRepository->artsLoadingDisabled -= DELEGATE0(&DataLoader::onAlbumRepositoryArtsLoadingDisabled);
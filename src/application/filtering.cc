@@ -11,6 +11,10 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <atomic>
+
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrent>
 
 #include "infrastructure/event/delegate.h"
 #include "domain/artist.h"
@@ -57,11 +61,19 @@ myIndices(indices) {
     myUi.albumsSelected += DELEGATE1(
         &Filtering::onAlbumsSelected, std::pair<std::vector<std::string>, std::vector<std::string>>);
     myUi.searchTriggered += DELEGATE1(&Filtering::onSearchTriggered, std::string);
+    myArtistRepository.loaded += DELEGATE1(&Filtering::onArtistsLoaded, std::pair<int, int>);
+    myAlbumRepository.loaded += DELEGATE1(&Filtering::onAlbumsLoaded, std::pair<int, int>);
+    myTrackRepository.loaded += DELEGATE1(&Filtering::onTracksLoaded, std::pair<int, int>);
 }
 
 
 
 Filtering::~Filtering() {
+    cancelSearch();
+
+    myTrackRepository.loaded -= DELEGATE1(&Filtering::onTracksLoaded, std::pair<int, int>);
+    myAlbumRepository.loaded -= DELEGATE1(&Filtering::onAlbumsLoaded, std::pair<int, int>);
+    myArtistRepository.loaded -= DELEGATE1(&Filtering::onArtistsLoaded, std::pair<int, int>);
     myUi.searchTriggered -= DELEGATE1(&Filtering::onSearchTriggered, std::string);
     myUi.albumsSelected -= DELEGATE1(
         &Filtering::onAlbumsSelected, std::pair<std::vector<std::string>, std::vector<std::string>>);
@@ -71,9 +83,13 @@ Filtering::~Filtering() {
 
 
 void Filtering::onArtistsSelected(const std::vector<std::string>& ids) {
+    myIsAlbumsFilterSelected = true;
+    myIsTracksFilterSelected = true;
     if (ids.empty()) {
         myAlbumRepository.unsetFilter();
         myTrackRepository.unsetFilter();
+        myAlbumNameFilter = nullptr;
+        myTrackNameFilter = nullptr;
     } else {
         setArtistFilters(ids);
     }
@@ -83,9 +99,11 @@ void Filtering::onArtistsSelected(const std::vector<std::string>& ids) {
 
 void Filtering::onAlbumsSelected(const std::pair<std::vector<std::string>,
                                  std::vector<std::string>>& albumAndArtistIds) {
+    myIsTracksFilterSelected = true;
     if (albumAndArtistIds.first.empty()) {
         if (albumAndArtistIds.second.empty()) {
             myTrackRepository.unsetFilter();
+            myTrackNameFilter = nullptr;
         } else {
             setArtistFilters(albumAndArtistIds.second);
         }
@@ -96,20 +114,82 @@ void Filtering::onAlbumsSelected(const std::pair<std::vector<std::string>,
             albums.push_back(*album);
         }
         myTrackRepository.setFilter(std::unique_ptr<Filter<TrackData>>{new AlbumFilterForTracks{albums, myIndices}});
+        myTrackNameFilter = nullptr;
     }
 }
 
 
 
 void Filtering::onSearchTriggered(const std::string& searchText) {
+    cancelSearch();
     if (searchText.empty()) {
         myArtistRepository.unsetFilter();
         myAlbumRepository.unsetFilter();
         myTrackRepository.unsetFilter();
+        myArtistNameFilter = nullptr;
+        myAlbumNameFilter = nullptr;
+        myTrackNameFilter = nullptr;
     } else {
-        myArtistRepository.setFilter(std::unique_ptr<Filter<ArtistData>>{new NameFilterForArtists{searchText}});
-        myAlbumRepository.setFilter(std::unique_ptr<Filter<AlbumData>>{new NameFilterForAlbums{searchText}});
-        myTrackRepository.setFilter(std::unique_ptr<Filter<TrackData>>{new NameFilterForTracks{searchText}});
+        startSearch(searchText);
+    }
+}
+
+
+
+void Filtering::onSearchFinished() {
+    auto searchResult = mySearchFutureWatcher->result();
+    mySearchFutureWatcher->deleteLater();
+    mySearchFutureWatcher = nullptr;
+
+    // the candidates did not include data loaded meanwhile so they are matched after the filters are set
+    myArtistNameFilter = new NameFilterForArtists{mySearchText, myArtistRepository.getNameIndex(),
+        searchResult->artistsData};
+    myArtistRepository.setFilter(std::unique_ptr<Filter<ArtistData>>{myArtistNameFilter});
+    for (auto& offsetAndLength: myArtistsLoadedDuringSearch) {
+        myArtistNameFilter->processUpdatedSourceData(offsetAndLength.first, offsetAndLength.second);
+    }
+
+    // filters set by a selection made during the search are newer than the search result
+    if (!myIsAlbumsFilterSelected) {
+        myAlbumNameFilter = new NameFilterForAlbums{mySearchText, myAlbumRepository.getNameIndex(),
+            searchResult->albumsData};
+        myAlbumRepository.setFilter(std::unique_ptr<Filter<AlbumData>>{myAlbumNameFilter});
+        for (auto& offsetAndLength: myAlbumsLoadedDuringSearch) {
+            myAlbumNameFilter->processUpdatedSourceData(offsetAndLength.first, offsetAndLength.second);
+        }
+    }
+    if (!myIsTracksFilterSelected) {
+        myTrackNameFilter = new NameFilterForTracks{mySearchText, myTrackRepository.getNameIndex(),
+            searchResult->tracksData};
+        myTrackRepository.setFilter(std::unique_ptr<Filter<TrackData>>{myTrackNameFilter});
+        for (auto& offsetAndLength: myTracksLoadedDuringSearch) {
+            myTrackNameFilter->processUpdatedSourceData(offsetAndLength.first, offsetAndLength.second);
+        }
+    }
+    clearLoadedDuringSearch();
+}
+
+
+
+void Filtering::onArtistsLoaded(std::pair<int, int> offsetAndLimit) {
+    if (mySearchFutureWatcher != nullptr && offsetAndLimit.second > 0) {
+        myArtistsLoadedDuringSearch.push_back(offsetAndLimit);
+    }
+}
+
+
+
+void Filtering::onAlbumsLoaded(std::pair<int, int> offsetAndLimit) {
+    if (mySearchFutureWatcher != nullptr && offsetAndLimit.second > 0) {
+        myAlbumsLoadedDuringSearch.push_back(offsetAndLimit);
+    }
+}
+
+
+
+void Filtering::onTracksLoaded(std::pair<int, int> offsetAndLimit) {
+    if (mySearchFutureWatcher != nullptr && offsetAndLimit.second > 0) {
+        myTracksLoadedDuringSearch.push_back(offsetAndLimit);
     }
 }
 
@@ -123,6 +203,82 @@ void Filtering::setArtistFilters(const std::vector<std::string>& ids) {
     }
     myAlbumRepository.setFilter(std::unique_ptr<Filter<AlbumData>>{new ArtistFilterForAlbums{artists, myIndices}});
     myTrackRepository.setFilter(std::unique_ptr<Filter<TrackData>>{new ArtistFilterForTracks{artists, myIndices}});
+    myAlbumNameFilter = nullptr;
+    myTrackNameFilter = nullptr;
+}
+
+
+
+void Filtering::startSearch(const std::string& searchText) {
+    mySearchText = searchText;
+    myIsAlbumsFilterSelected = false;
+    myIsTracksFilterSelected = false;
+    clearLoadedDuringSearch();
+
+    // candidates are selected on this thread since the repository data are changed on it; they are results of the
+    // previous filters if the search text was extended; the data items stay valid while the search is in progress
+    // because the search is cancelled (by an empty search text) before the repositories are cleared
+    auto artistsCandidates = NameFilterForArtists::selectCandidates(searchText, myArtistRepository.getNameIndex(),
+        myArtistRepository.getData(), myArtistNameFilter);
+    auto albumsCandidates = NameFilterForAlbums::selectCandidates(searchText, myAlbumRepository.getNameIndex(),
+        myAlbumRepository.getData(), myAlbumNameFilter);
+    auto tracksCandidates = NameFilterForTracks::selectCandidates(searchText, myTrackRepository.getNameIndex(),
+        myTrackRepository.getData(), myTrackNameFilter);
+
+    // the name indices are not cleared while the search is in progress for the same reason
+    auto& artistsNameIndex = myArtistRepository.getNameIndex();
+    auto& albumsNameIndex = myAlbumRepository.getNameIndex();
+    auto& tracksNameIndex = myTrackRepository.getNameIndex();
+
+    auto isSearchCancelled = std::make_shared<std::atomic<bool>>(false);
+    myIsSearchCancelled = isSearchCancelled;
+    mySearchFutureWatcher = new QFutureWatcher<std::shared_ptr<SearchResult>>();
+    QObject::connect(mySearchFutureWatcher, &QFutureWatcher<std::shared_ptr<SearchResult>>::finished,
+        [this]() {onSearchFinished(); });
+    mySearchFutureWatcher->setFuture(QtConcurrent::run([searchText, &artistsNameIndex, &albumsNameIndex,
+        &tracksNameIndex, artistsCandidates, albumsCandidates, tracksCandidates, isSearchCancelled]() {
+
+        auto isCancelled = [isSearchCancelled]() {return isSearchCancelled->load(); };
+
+        // artists and albums are matched concurrently with tracks
+        auto artistsFuture = QtConcurrent::run([&]() {
+            return NameFilterForArtists::matchCandidates(searchText, artistsNameIndex, artistsCandidates,
+                isCancelled);
+        });
+        auto albumsFuture = QtConcurrent::run([&]() {
+            return NameFilterForAlbums::matchCandidates(searchText, albumsNameIndex, albumsCandidates, isCancelled);
+        });
+        auto searchResult = std::make_shared<SearchResult>();
+        searchResult->tracksData = NameFilterForTracks::matchCandidates(searchText, tracksNameIndex, tracksCandidates,
+            isCancelled);
+        searchResult->artistsData = artistsFuture.result();
+        searchResult->albumsData = albumsFuture.result();
+        return searchResult;
+    }));
+}
+
+
+
+void Filtering::cancelSearch() {
+    if (mySearchFutureWatcher == nullptr) {
+        return;
+    }
+
+    // the matching checks the flag frequently so the waiting is short
+    *myIsSearchCancelled = true;
+    mySearchFutureWatcher->disconnect();
+    mySearchFutureWatcher->waitForFinished();
+    delete mySearchFutureWatcher;
+    mySearchFutureWatcher = nullptr;
+    clearLoadedDuringSearch();
+}
+
+
+
+void Filtering::clearLoadedDuringSearch() {
+    myArtistsLoadedDuringSearch.clear();
+    myAlbumsLoadedDuringSearch.clear();
+    myTracksLoadedDuringSearch.clear();
 }
 
 }
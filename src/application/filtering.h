@@ -15,6 +15,10 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <memory>
+#include <atomic>
+
+#include <QFutureWatcher>
 
 namespace ui {
 class Ui;
@@ -25,6 +29,12 @@ class ArtistRepository;
 class AlbumRepository;
 class TrackRepository;
 class Indices;
+class ArtistData;
+class AlbumData;
+class TrackData;
+class NameFilterForArtists;
+class NameFilterForAlbums;
+class NameFilterForTracks;
 }
 
 
@@ -35,6 +45,10 @@ namespace application {
  * @brief Filtering logic.
  *
  * Interconnects UI and data model in order to enable filtering.
+ *
+ * Names are matched with the search text on a worker thread; a search is cancelled when a newer one is triggered and
+ * only the result of the latest search is set to the repositories.  Filters set by a selection made while the search
+ * is in progress are kept.
  */
 class Filtering {
 
@@ -51,11 +65,49 @@ private:
     data::TrackRepository& myTrackRepository;
     data::Indices& myIndices;
 
+    // name filters set by the last search which are refined by the next one; null if they are not set anymore
+    data::NameFilterForArtists* myArtistNameFilter = nullptr;
+    data::NameFilterForAlbums* myAlbumNameFilter = nullptr;
+    data::NameFilterForTracks* myTrackNameFilter = nullptr;
+
+    // result of the search running on a worker thread
+    struct SearchResult {
+        std::vector<std::pair<int, data::ArtistData*>> artistsData;
+        std::vector<std::pair<int, data::AlbumData*>> albumsData;
+        std::vector<std::pair<int, data::TrackData*>> tracksData;
+    };
+
+    // text of the search in progress
+    std::string mySearchText;
+
+    // watches the search in progress; null if no search is in progress
+    QFutureWatcher<std::shared_ptr<SearchResult>>* mySearchFutureWatcher = nullptr;
+
+    // set to cancel the search in progress
+    std::shared_ptr<std::atomic<bool>> myIsSearchCancelled;
+
+    // set if a selection changed the filter of albums or tracks after the search was started; the result of the search
+    // does not replace such filter
+    bool myIsAlbumsFilterSelected = false;
+    bool myIsTracksFilterSelected = false;
+
+    // <offset, length> ranges of data loaded while the search was in progress
+    std::vector<std::pair<int, int>> myArtistsLoadedDuringSearch;
+    std::vector<std::pair<int, int>> myAlbumsLoadedDuringSearch;
+    std::vector<std::pair<int, int>> myTracksLoadedDuringSearch;
+
     void onArtistsSelected(const std::vector<std::string>& ids);
     void onAlbumsSelected(const std::pair<std::vector<std::string>, std::vector<std::string>>& albumAndArtistIds);
     void onSearchTriggered(const std::string& searchText);
+    void onSearchFinished();
+    void onArtistsLoaded(std::pair<int, int> offsetAndLimit);
+    void onAlbumsLoaded(std::pair<int, int> offsetAndLimit);
+    void onTracksLoaded(std::pair<int, int> offsetAndLimit);
 
     void setArtistFilters(const std::vector<std::string>& ids);
+    void startSearch(const std::string& searchText);
+    void cancelSearch();
+    void clearLoadedDuringSearch();
 };
 
 }
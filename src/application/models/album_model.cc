@@ -7,8 +7,10 @@
 
 
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <Qt>
 #include <QtCore/QVariant>
@@ -39,22 +41,27 @@ namespace application {
 AlbumModel::AlbumModel(
     AlbumRepository* const albumRepository, int thumbnailSize, QObject* parent): QAbstractTableModel(parent),
 myAlbumRepository(albumRepository),
-myThumbnailSize(thumbnailSize) {
+myThumbnailSize(thumbnailSize),
+myAlbumRequests{new Requests{60, albumRepository->getLoadWindow()}},
+myRowCount{myAlbumRepository->count()} {
     myAlbumRequests->readyToExecute += DELEGATE1(&AlbumModel::onReadyToExecuteAlbums, RequestGroup);
     myAlbumRepository->loaded += DELEGATE1(&AlbumModel::onLoaded, std::pair<int, int>);
     myArtRequests->readyToExecute += DELEGATE1(&AlbumModel::onReadyToExecuteArts, RequestGroup);
     myAlbumRepository->artsLoaded += DELEGATE1(&AlbumModel::onArtsLoaded, std::pair<int, int>);
-    myAlbumRepository->dataSizeChanged += DELEGATE0(&AlbumModel::onDataSizeOrFilterChanged);
-    myAlbumRepository->filterChanged += DELEGATE0(&AlbumModel::onDataSizeOrFilterChanged);
+    myAlbumRepository->dataSizeChanged += DELEGATE0(&AlbumModel::onDataSizeChanged);
+    myAlbumRepository->filterChanged += DELEGATE0(&AlbumModel::onFilterChanged);
     myAlbumRepository->providerChanged += DELEGATE0(&AlbumModel::onProviderChanged);
+    myAlbumRepository->acknowledgeFilteredData();
+    myUpdateCoalescer->readyToApply += DELEGATE1(&AlbumModel::onReadyToApply, ModelUpdate);
 }
 
 
 
 AlbumModel::~AlbumModel() {
+    myUpdateCoalescer->readyToApply -= DELEGATE1(&AlbumModel::onReadyToApply, ModelUpdate);
     myAlbumRepository->providerChanged -= DELEGATE0(&AlbumModel::onProviderChanged);
-    myAlbumRepository->filterChanged -= DELEGATE0(&AlbumModel::onDataSizeOrFilterChanged);
-    myAlbumRepository->dataSizeChanged -= DELEGATE0(&AlbumModel::onDataSizeOrFilterChanged);
+    myAlbumRepository->filterChanged -= DELEGATE0(&AlbumModel::onFilterChanged);
+    myAlbumRepository->dataSizeChanged -= DELEGATE0(&AlbumModel::onDataSizeChanged);
     myAlbumRepository->artsLoaded -= DELEGATE1(&AlbumModel::onArtsLoaded, std::pair<int, int>);
     myArtRequests->readyToExecute -= DELEGATE1(&AlbumModel::onReadyToExecuteArts, RequestGroup);
     myAlbumRepository->loaded -= DELEGATE1(&AlbumModel::onLoaded, std::pair<int, int>);
@@ -79,7 +86,7 @@ QVariant AlbumModel::data(const QModelIndex& index, int role) const {
 
     int row = index.row();
     if (!myAlbumRepository->isLoaded(row)) {
-        if (role == Qt::DisplayRole && !myAlbumRepository->isFiltered()) {
+        if (role == Qt::DisplayRole && !myAlbumRepository->isFiltered() && row < myAlbumRepository->count()) {
             myAlbumRequests->add(row);
         }
         return notLoaded;
@@ -114,7 +121,7 @@ QVariant AlbumModel::data(const QModelIndex& index, int role) const {
 
 
 int AlbumModel::rowCount(const QModelIndex&) const {
-    return myAlbumRepository->count();
+    return myRowCount;
 }
 
 
@@ -133,7 +140,7 @@ void AlbumModel::onReadyToExecuteAlbums(RequestGroup requestGroup) {
 
 void AlbumModel::onLoaded(std::pair<int, int> offsetAndLimit) {
     myAlbumRequests->setFinished(offsetAndLimit.first, offsetAndLimit.second);
-    dataChanged(createIndex(offsetAndLimit.first, 0), createIndex(offsetAndLimit.first + offsetAndLimit.second - 1, 0));
+    myUpdateCoalescer->addChangedRows(offsetAndLimit.first, offsetAndLimit.second);
 }
 
 
@@ -154,10 +161,7 @@ void AlbumModel::onArtsLoaded(std::pair<int, int> offsetAndCount) {
         return;
     }
 
-    if (offsetAndCount.second != 0) {
-        dataChanged(createIndex(offsetAndCount.first, 0),
-                    createIndex(offsetAndCount.first + offsetAndCount.second - 1, 0));
-    }
+    myUpdateCoalescer->addChangedRows(offsetAndCount.first, offsetAndCount.second);
 
     if (!myArtRequests->isInProgress()) {
 
@@ -170,29 +174,97 @@ void AlbumModel::onArtsLoaded(std::pair<int, int> offsetAndCount) {
 
 
 
-void AlbumModel::onDataSizeOrFilterChanged() {
-    beginResetModel();
+void AlbumModel::onDataSizeChanged() {
 
-    LOG_DBG("Removing all art requests.");
-    myArtRequests->removeAll();
+    // a filter reports changes of its data as a change of the data size
+    if (myAlbumRepository->isFiltered()) {
+        myUpdateCoalescer->setResetNeeded();
+    } else {
+        myUpdateCoalescer->setSizeChanged();
+    }
+    restartArtsLoading();
+}
 
-    // filterChanged event is fired even if it does not results to an actual change of filtered data; it that case
-    // if all requests from views (via data()) were already executed, no futher request will be added; therefore the
-    // loading of all remaining arts is re-initiated here because all requests were removed above
-    if (myIsInUnfilteredArtsLoadMode) {
-        requestUnloadedArts();
+
+
+void AlbumModel::onFilterChanged() {
+    myUpdateCoalescer->setResetNeeded();
+    restartArtsLoading();
+}
+
+
+
+void AlbumModel::onReadyToApply(ModelUpdate& modelUpdate) {
+    auto rowCount = myAlbumRepository->count();
+    if (modelUpdate.isResetNeeded) {
+        std::vector<FilteredDataChange> changes;
+        if (!myAlbumRepository->takeFilteredDataChanges(changes)) {
+            beginResetModel();
+            myRowCount = rowCount;
+            endResetModel();
+            return;
+        }
+
+        for (auto& change: changes) {
+            if (change.isInsertion) {
+                beginInsertRows(QModelIndex{}, change.offset, change.offset + change.count - 1);
+                myRowCount += change.count;
+                endInsertRows();
+            } else {
+                beginRemoveRows(QModelIndex{}, change.offset, change.offset + change.count - 1);
+                myRowCount -= change.count;
+                endRemoveRows();
+            }
+        }
+
+        // art requests were removed so the views are made to request arts of the shown albums again
+        if (myRowCount > 0) {
+            dataChanged(createIndex(0, 0), createIndex(myRowCount - 1, 0));
+        }
+        return;
     }
 
-    endResetModel();
+    // while a filter is set every change of the filtered data needs a reset so the acknowledged ones are current;
+    // without it only the size of the filtered data is acknowledged
+    if (!myAlbumRepository->isFiltered()) {
+        myAlbumRepository->acknowledgeFilteredData();
+    }
+
+    // without a filter the data items are not reordered so only the rows at the end are inserted or removed
+    if (rowCount > myRowCount) {
+        beginInsertRows(QModelIndex{}, myRowCount, rowCount - 1);
+        myRowCount = rowCount;
+        endInsertRows();
+    } else if (rowCount < myRowCount) {
+        beginRemoveRows(QModelIndex{}, rowCount, myRowCount - 1);
+        myRowCount = rowCount;
+        endRemoveRows();
+    }
+
+    if (modelUpdate.isSizeChanged) {
+        if (myRowCount > 0) {
+            dataChanged(createIndex(0, 0), createIndex(myRowCount - 1, columnCount() - 1));
+        }
+        return;
+    }
+    for (auto& changedRows: modelUpdate.changedRows) {
+        auto lastRow = std::min(changedRows.second, myRowCount - 1);
+        if (changedRows.first <= lastRow) {
+            dataChanged(createIndex(changedRows.first, 0), createIndex(lastRow, 0));
+        }
+    }
 }
 
 
 
 void AlbumModel::onProviderChanged() {
     beginResetModel();
+    myUpdateCoalescer->clear();
     myAlbumRequests->removeAll();
     myArtRequests->removeAll();
     requestAllData();
+    myRowCount = myAlbumRepository->count();
+    myAlbumRepository->acknowledgeFilteredData();
     endResetModel();
 }
 
@@ -200,23 +272,43 @@ void AlbumModel::onProviderChanged() {
 
 void AlbumModel::requestAllData() {
     LOG_DBG("Requesting all data.");
-    for (int row = 0; row < myAlbumRepository->maxCount(); row++) {
-        myAlbumRequests->add(row);
-    }
+    myAlbumRequests->add(0, myAlbumRepository->maxCount());
 }
 
 
 
 void AlbumModel::requestUnloadedArts() {
     LOG_DBG("Requesting all unloaded arts.");
+
+    // consecutive albums without arts are requested at once
+    int firstRow = -1;
     for (int row = 0; row < myAlbumRepository->maxCount(); row++) {
-        if (myAlbumRepository->isLoadedUnfiltered(row)) {
-            auto& album = myAlbumRepository->getUnfiltered(row);
-            if (!album.hasArt()) {
-                myArtRequests->add(row);
+        if (myAlbumRepository->isLoadedUnfiltered(row) && !myAlbumRepository->getUnfiltered(row).hasArt()) {
+            if (firstRow == -1) {
+                firstRow = row;
             }
+        } else if (firstRow != -1) {
+            myArtRequests->add(firstRow, row - firstRow);
+            firstRow = -1;
         }
     }
+    if (firstRow != -1) {
+        myArtRequests->add(firstRow, myAlbumRepository->maxCount() - firstRow);
+    }
+}
+
+
+
+void AlbumModel::restartArtsLoading() {
+    LOG_DBG("Removing all art requests.");
+    myArtRequests->removeAll();
+
+    // filterChanged event is fired even if it does not results to an actual change of filtered data; it that case
+    // if all requests from views (via data()) were already executed, no futher request will be added; therefore the
+    // loading of all remaining arts is re-initiated here because all requests were removed above
+    if (myIsInUnfilteredArtsLoadMode) {
+        requestUnloadedArts();
+    }
 }
 
 }
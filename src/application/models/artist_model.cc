@@ -7,7 +7,9 @@
 
 
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include <Qt>
 #include <QtCore/QVariant>
@@ -33,20 +35,25 @@ using namespace domain;
 namespace application {
 
 ArtistModel::ArtistModel(ArtistRepository* const artistRepository, QObject* parent): QAbstractTableModel(parent),
-myArtistRepository(artistRepository) {
+myArtistRepository(artistRepository),
+myRequests{new Requests{60, artistRepository->getLoadWindow()}},
+myRowCount{myArtistRepository->count()} {
     myRequests->readyToExecute += DELEGATE1(&ArtistModel::onReadyToExecute, RequestGroup);
     myArtistRepository->loaded += DELEGATE1(&ArtistModel::onLoaded, std::pair<int, int>);
-    myArtistRepository->dataSizeChanged += DELEGATE0(&ArtistModel::onDataSizeOrFilterChanged);
-    myArtistRepository->filterChanged += DELEGATE0(&ArtistModel::onDataSizeOrFilterChanged);
+    myArtistRepository->dataSizeChanged += DELEGATE0(&ArtistModel::onDataSizeChanged);
+    myArtistRepository->filterChanged += DELEGATE0(&ArtistModel::onFilterChanged);
     myArtistRepository->providerChanged += DELEGATE0(&ArtistModel::onProviderChanged);
+    myArtistRepository->acknowledgeFilteredData();
+    myUpdateCoalescer->readyToApply += DELEGATE1(&ArtistModel::onReadyToApply, ModelUpdate);
 }
 
 
 
 ArtistModel::~ArtistModel() {
+    myUpdateCoalescer->readyToApply -= DELEGATE1(&ArtistModel::onReadyToApply, ModelUpdate);
     myArtistRepository->providerChanged -= DELEGATE0(&ArtistModel::onProviderChanged);
-    myArtistRepository->filterChanged -= DELEGATE0(&ArtistModel::onDataSizeOrFilterChanged);
-    myArtistRepository->dataSizeChanged -= DELEGATE0(&ArtistModel::onDataSizeOrFilterChanged);
+    myArtistRepository->filterChanged -= DELEGATE0(&ArtistModel::onFilterChanged);
+    myArtistRepository->dataSizeChanged -= DELEGATE0(&ArtistModel::onDataSizeChanged);
     myArtistRepository->loaded -= DELEGATE1(&ArtistModel::onLoaded, std::pair<int, int>);
     myRequests->readyToExecute -= DELEGATE1(&ArtistModel::onReadyToExecute, RequestGroup);
 }
@@ -60,7 +67,7 @@ QVariant ArtistModel::data(const QModelIndex& index, int role) const {
 
     int row = index.row();
     if (!myArtistRepository->isLoaded(row)) {
-        if (role == Qt::DisplayRole && !myArtistRepository->isFiltered()) {
+        if (role == Qt::DisplayRole && !myArtistRepository->isFiltered() && row < myArtistRepository->count()) {
             myRequests->add(row);
         }
         return "...";
@@ -78,7 +85,7 @@ QVariant ArtistModel::data(const QModelIndex& index, int role) const {
 
 
 int ArtistModel::rowCount(const QModelIndex&) const {
-    return myArtistRepository->count();
+    return myRowCount;
 }
 
 
@@ -97,22 +104,95 @@ void ArtistModel::onReadyToExecute(RequestGroup requestGroup) {
 
 void ArtistModel::onLoaded(std::pair<int, int> offsetAndLimit) {
     myRequests->setFinished(offsetAndLimit.first, offsetAndLimit.second);
-    dataChanged(createIndex(offsetAndLimit.first, 0), createIndex(offsetAndLimit.first + offsetAndLimit.second - 1, 0));
+    myUpdateCoalescer->addChangedRows(offsetAndLimit.first, offsetAndLimit.second);
 }
 
 
 
-void ArtistModel::onDataSizeOrFilterChanged() {
-    beginResetModel();
-    endResetModel();
+void ArtistModel::onDataSizeChanged() {
+
+    // a filter reports changes of its data as a change of the data size
+    if (myArtistRepository->isFiltered()) {
+        myUpdateCoalescer->setResetNeeded();
+    } else {
+        myUpdateCoalescer->setSizeChanged();
+    }
+}
+
+
+
+void ArtistModel::onFilterChanged() {
+    myUpdateCoalescer->setResetNeeded();
+}
+
+
+
+void ArtistModel::onReadyToApply(ModelUpdate& modelUpdate) {
+    auto rowCount = myArtistRepository->count();
+    if (modelUpdate.isResetNeeded) {
+        std::vector<FilteredDataChange> changes;
+        if (!myArtistRepository->takeFilteredDataChanges(changes)) {
+            beginResetModel();
+            myRowCount = rowCount;
+            endResetModel();
+            return;
+        }
+
+        for (auto& change: changes) {
+            if (change.isInsertion) {
+                beginInsertRows(QModelIndex{}, change.offset, change.offset + change.count - 1);
+                myRowCount += change.count;
+                endInsertRows();
+            } else {
+                beginRemoveRows(QModelIndex{}, change.offset, change.offset + change.count - 1);
+                myRowCount -= change.count;
+                endRemoveRows();
+            }
+        }
+        return;
+    }
+
+    // while a filter is set every change of the filtered data needs a reset so the acknowledged ones are current;
+    // without it only the size of the filtered data is acknowledged
+    if (!myArtistRepository->isFiltered()) {
+        myArtistRepository->acknowledgeFilteredData();
+    }
+
+    // without a filter the data items are not reordered so only the rows at the end are inserted or removed
+    if (rowCount > myRowCount) {
+        beginInsertRows(QModelIndex{}, myRowCount, rowCount - 1);
+        myRowCount = rowCount;
+        endInsertRows();
+    } else if (rowCount < myRowCount) {
+        beginRemoveRows(QModelIndex{}, rowCount, myRowCount - 1);
+        myRowCount = rowCount;
+        endRemoveRows();
+    }
+
+    // the data size is changed also when deferred data items are linked so all rows are refreshed then
+    if (modelUpdate.isSizeChanged) {
+        if (myRowCount > 0) {
+            dataChanged(createIndex(0, 0), createIndex(myRowCount - 1, columnCount() - 1));
+        }
+        return;
+    }
+    for (auto& changedRows: modelUpdate.changedRows) {
+        auto lastRow = std::min(changedRows.second, myRowCount - 1);
+        if (changedRows.first <= lastRow) {
+            dataChanged(createIndex(changedRows.first, 0), createIndex(lastRow, 0));
+        }
+    }
 }
 
 
 
 void ArtistModel::onProviderChanged() {
     beginResetModel();
+    myUpdateCoalescer->clear();
     myRequests->removeAll();
     requestAllData();
+    myRowCount = myArtistRepository->count();
+    myArtistRepository->acknowledgeFilteredData();
     endResetModel();
 }
 
@@ -120,9 +200,7 @@ void ArtistModel::onProviderChanged() {
 
 void ArtistModel::requestAllData() {
     LOG_DBG("Requesting all data.");
-    for (int row = 0; row < myArtistRepository->maxCount(); row++) {
-        myRequests->add(row);
-    }
+    myRequests->add(0, myArtistRepository->maxCount());
 }
 
 }
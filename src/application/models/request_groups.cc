@@ -7,6 +7,9 @@
 
 
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <utility>
 
 #include "request_group.h"
@@ -28,172 +31,120 @@ bool RequestGroups::isEmpty() const {
 
 
 void RequestGroups::cut(RequestGroup requestGroup) {
-    cutRequestGroup(requestGroup);
-    chop();
+    if (requestGroup.isEmpty()) {
+        return;
+    }
+
+    // the first intersecting group may start below the cut group
+    auto requestGroupIter = myRequestGroups.upper_bound(requestGroup.getLower());
+    if (requestGroupIter != myRequestGroups.begin() &&
+        std::prev(requestGroupIter)->second.first.getUpper() >= requestGroup.getLower()) {
+
+        --requestGroupIter;
+    }
+
+    while (requestGroupIter != myRequestGroups.end() && requestGroupIter->first <= requestGroup.getUpper()) {
+        auto intersectingGroup = requestGroupIter->second.first;
+        auto priority = requestGroupIter->second.second;
+        requestGroupIter = eraseRequestGroup(requestGroupIter);
+
+        std::pair<RequestGroup, RequestGroup> remainderGroups = intersectingGroup.substract(requestGroup);
+        if (!remainderGroups.first.isEmpty()) {
+            insertRequestGroup(remainderGroups.first, priority);
+        }
+        if (!remainderGroups.second.isEmpty()) {
+            insertRequestGroup(remainderGroups.second, priority);
+        }
+    }
 }
 
 
 
 void RequestGroups::moveOnTop(RequestGroup requestGroup) {
-    cutRequestGroup(requestGroup);
-    myRequestGroups.push_back(requestGroup);
-    chop();
+    cut(requestGroup);
+
+    if (myGranularity != 0 && !myPriorities.empty()) {
+        auto topGroupIter = myRequestGroups.find(myPriorities.rbegin()->second);
+        auto topGroup = topGroupIter->second.first;
+        if (topGroup.getUpper() + 1 == requestGroup.getLower() || requestGroup.getUpper() + 1 == topGroup.getLower()) {
+            eraseRequestGroup(topGroupIter);
+            requestGroup = RequestGroup{std::min(topGroup.getLower(), requestGroup.getLower()),
+                std::max(topGroup.getUpper(), requestGroup.getUpper())};
+        }
+    }
+    insertRequestGroup(requestGroup, ++myTopPriority);
 }
 
 
 
 bool RequestGroups::extend(int offset) {
     if (myRequestGroups.empty()) {
-        myRequestGroups.push_back(RequestGroup{offset, offset});
+        insertRequestGroup(RequestGroup{offset, offset}, ++myTopPriority);
         return true;
     }
 
-    auto extensibleGroupIdx = findExtensibleGroupIdx(offset);
-    if (extensibleGroupIdx == -1) {
+    // only the group which contains the preceding offset can be extended since the groups are disjoint
+    auto extensibleGroupIter = myRequestGroups.upper_bound(offset - 1);
+    if (extensibleGroupIter == myRequestGroups.begin() ||
+        !std::prev(extensibleGroupIter)->second.first.canBeExtendedToOffset(offset)) {
+
         return false;
     }
+    --extensibleGroupIter;
 
-    auto owningGroupIdx = findOwningGroupIdx(offset);
-
-    auto& extensibleGroup = myRequestGroups[extensibleGroupIdx];
-    extensibleGroup.extend();
-
-    if (owningGroupIdx != -1) {
-        auto& owningGroup = myRequestGroups[owningGroupIdx];
+    auto owningGroupIter = myRequestGroups.find(offset);
+    if (owningGroupIter != myRequestGroups.end()) {
+        auto owningGroup = owningGroupIter->second.first;
+        auto priority = owningGroupIter->second.second;
+        eraseRequestGroup(owningGroupIter);
         owningGroup.shrink();
-        if (owningGroup.isEmpty()) {
-            myRequestGroups.erase(myRequestGroups.begin() + owningGroupIdx);
+        if (!owningGroup.isEmpty()) {
+            insertRequestGroup(owningGroup, priority);
         }
     }
-    chop();
+
+    // the lower bound does not change so the group is extended in place
+    extensibleGroupIter->second.first.extend();
     return true;
 }
 
 
 
 RequestGroup RequestGroups::pop() {
-    auto poppedGroup = myRequestGroups.back();
-    myRequestGroups.pop_back();
-    return poppedGroup;
-}
-
-
-
-void RequestGroups::clear() {
-    myRequestGroups.clear();
-}
-
-
-
-void RequestGroups::cutRequestGroup(RequestGroup requestGroup) {
-    auto intersectingGroupIdxs = findIntersectingGroupIdxs(requestGroup);
-    for (auto idx = intersectingGroupIdxs.size(); idx-- > 0;) {
-        auto intersectingGroupIdx = intersectingGroupIdxs[idx];
-        auto intersectingGroup = myRequestGroups[intersectingGroupIdx];
-        std::pair<RequestGroup, RequestGroup> remainderGroups = intersectingGroup.substract(requestGroup);
-
-        myRequestGroups.erase(myRequestGroups.begin() + intersectingGroupIdx);
-        if (!remainderGroups.second.isEmpty()) {
-            myRequestGroups.insert(myRequestGroups.begin() + intersectingGroupIdx, remainderGroups.second);
-        }
-        if (!remainderGroups.first.isEmpty()) {
-            myRequestGroups.insert(myRequestGroups.begin() + intersectingGroupIdx, remainderGroups.first);
-        }
+    auto priority = myPriorities.rbegin()->first;
+    auto topGroupIter = myRequestGroups.find(myPriorities.rbegin()->second);
+    auto topGroup = topGroupIter->second.first;
+    eraseRequestGroup(topGroupIter);
+    if (myGranularity == 0 || topGroup.getSize() <= myGranularity) {
+        return topGroup;
     }
-}
-
 
-
-void RequestGroups::chop() {
-    if (myGranularity == 0) {
-        return;
-    }
-
-    std::vector<RequestGroup> choppedGroups;
-    for (auto& group: myRequestGroups) {
-        if (group.getSize() > myGranularity) {
-            auto split = group.split(group.getUpper() - (myGranularity - 1));
-            while (split.first.getSize() > myGranularity) {
-                choppedGroups.push_back(split.second);
-                split = group.split(split.first.getUpper() - (myGranularity - 1));
-            }
-            choppedGroups.push_back(split.second);
-            choppedGroups.push_back(split.first);
-        } else {
-            appendOnTop(choppedGroups, group);
-        }
-    }
-    myRequestGroups = choppedGroups;
+    auto split = topGroup.split(topGroup.getLower() + myGranularity);
+    insertRequestGroup(split.second, priority);
+    return split.first;
 }
 
 
 
-void RequestGroups::appendOnTop(std::vector<RequestGroup>& groups, RequestGroup groupToPlace) {
-    if (groups.size() == 0) {
-        groups.push_back(groupToPlace);
-        return;
-    }
-
-    auto lastGroup = groups.back();
-
-    RequestGroup jointGroup{};
-    if (lastGroup.getUpper() + 1 == groupToPlace.getLower()) {
-        jointGroup = RequestGroup{lastGroup.getLower(), groupToPlace.getUpper()};
-    } else if (lastGroup.getLower() - 1 == groupToPlace.getUpper()) {
-        jointGroup = RequestGroup{groupToPlace.getLower(), lastGroup.getUpper()};
-    }
-    if (!jointGroup.isEmpty()) {
-        groups.pop_back();
-        if (jointGroup.getSize() > myGranularity) {
-            auto split = jointGroup.split(jointGroup.getLower() + myGranularity);
-            groups.push_back(split.second);
-            groups.push_back(split.first);
-        } else {
-            groups.push_back(jointGroup);
-        }
-    } else {
-        groups.push_back(groupToPlace);
-    }
+void RequestGroups::clear() {
+    myRequestGroups.clear();
+    myPriorities.clear();
 }
 
 
 
-int RequestGroups::findOwningGroupIdx(int offset) const {
-    int idx = 0;
-    for (auto& requestGroup: myRequestGroups) {
-        if (requestGroup.isMember(offset)) {
-            return idx;
-        }
-        idx++;
-    }
-    return -1;
+void RequestGroups::insertRequestGroup(RequestGroup requestGroup, uint64_t priority) {
+    myRequestGroups.emplace(requestGroup.getLower(), std::make_pair(requestGroup, priority));
+    myPriorities.emplace(priority, requestGroup.getLower());
 }
 
 
 
-int RequestGroups::findExtensibleGroupIdx(int offset) const {
-    int idx = 0;
-    for (auto requestGroup: myRequestGroups) {
-        if (requestGroup.canBeExtendedToOffset(offset)) {
-            return idx;
-        }
-        idx++;
-    }
-    return -1;
-}
-
+RequestGroups::PrioritizedGroups::iterator RequestGroups::eraseRequestGroup(
+    PrioritizedGroups::iterator requestGroupIter) {
 
-
-std::vector<int> RequestGroups::findIntersectingGroupIdxs(RequestGroup requestGroup) const {
-    std::vector<int> intersectingGroups{};
-    int idx = 0;
-    for (auto& group: myRequestGroups) {
-        if (requestGroup.hasIntersection(group)) {
-            intersectingGroups.push_back(idx);
-        }
-        idx++;
-    }
-    return intersectingGroups;
+    myPriorities.erase(std::make_pair(requestGroupIter->second.second, requestGroupIter->first));
+    return myRequestGroups.erase(requestGroupIter);
 }
 
 }
@@ -12,7 +12,10 @@
 
 
 
-#include <vector>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
 
 #include "request_group.h"
 
@@ -21,7 +24,11 @@
 namespace application {
 
 /**
- * @brief Set of size bounded RequestGroup() objects.
+ * @brief Set of disjoint RequestGroup() objects ordered by their priority.
+ *
+ * Groups are stored by their lower bounds so that groups affected by an operation are found in logarithmic time.
+ * The group placed on top most recently has the highest priority.  Groups are not limited by the granularity while
+ * they are stored; pop() takes at most granularity of the smallest members of the top group.
  */
 class RequestGroups {
 
@@ -29,7 +36,7 @@ public:
     /**
      * @brief Constructor.
      *
-     * @param granularity The maximal size of member groups.  0 if unlimited.
+     * @param granularity The maximal size of popped groups.  0 if unlimited.
      */
     explicit RequestGroups(int granularity);
 
@@ -48,9 +55,7 @@ public:
      *
      * The operation modifies/removes affected groups as needed.  For example if @p requestGroup is big, spreading
      * over (intersecting with) several groups in the set, inner intersecting groups are removed and groups
-     * intersecting on bounds are shrinked accordingly.
-     *
-     * @note The entire set is then modified so that no group is bigger than the set granularity.
+     * intersecting on bounds are shrinked accordingly.  Remainders of a group keep its priority.
      *
      * @param requestGroup Group that shall be cut.
      */
@@ -59,7 +64,7 @@ public:
     /**
      * @brief Cuts @p requestGroup from the set and places it on top.
      *
-     * @note The entire set is then modified so that no group is bigger than the set granularity.
+     * If the group adjoins the group which is currently on top they are joined.
      *
      * @param requestGroup The group that shall be cut and moved.
      *
@@ -70,7 +75,7 @@ public:
     /**
      * @brief Make grup determined by @p offset bigger by one.
      *
-     * Another group may be shrinked in order to prevent overlapping.
+     * Another group may be shrinked in order to prevent overlapping.  The priority of the extended group is kept.
      *
      * @param offset Group extensible to this offset shall be extended.
      * @return true if a group was extended, false no group extensible to the @p offset was found.
@@ -80,9 +85,11 @@ public:
     /**
      * @brief Removes and returns group from top of the set.
      *
+     * If the top group is bigger than the granularity only its smallest members are removed; the rest stays on top.
+     *
      * @return application::RequestGroup
      *
-     * @sa cutAndPlaceOnTop()
+     * @sa moveOnTop()
      */
     RequestGroup pop();
 
@@ -92,18 +99,23 @@ public:
     void clear();
 
 private:
+    // <lower bound, <group, priority>> map
+    using PrioritizedGroups = std::map<int, std::pair<RequestGroup, uint64_t>>;
+
     // argument from the constructor
     const int myGranularity;
 
-    // stored groups
-    std::vector<RequestGroup> myRequestGroups;
+    // stored groups and their priorities by lower bounds of the groups
+    PrioritizedGroups myRequestGroups;
+
+    // <priority, lower bound> pairs of the stored groups; the top group is the last one
+    std::set<std::pair<uint64_t, int>> myPriorities;
+
+    // priority of the group which was placed on top most recently
+    uint64_t myTopPriority = 0;
 
-    void cutRequestGroup(RequestGroup requestGroup);
-    void chop();
-    void appendOnTop(std::vector<RequestGroup>& groups, RequestGroup groupToPlace);
-    int findOwningGroupIdx(int offset) const;
-    int findExtensibleGroupIdx(int offset) const;
-    std::vector<int> findIntersectingGroupIdxs(RequestGroup requestGroup) const;
+    void insertRequestGroup(RequestGroup requestGroup, uint64_t priority);
+    PrioritizedGroups::iterator eraseRequestGroup(PrioritizedGroups::iterator requestGroupIter);
 };
 
 }
@@ -7,6 +7,9 @@
 
 
 
+#include <algorithm>
+#include <vector>
+
 #include "request_group.h"
 #include "request_groups.h"
 #include "requests.h"
@@ -15,8 +18,13 @@
 
 namespace application {
 
-Requests::Requests(int granularity):
-myRequestGroups{new RequestGroups{granularity}} { }
+Requests::Requests(int granularity, int window):
+myRequestGroups{new RequestGroups{granularity}},
+myWindow{window} { }
+
+
+
+Requests::Requests(int granularity): Requests(granularity, 1) { }
 
 
 
@@ -24,15 +32,17 @@ Requests::Requests(): Requests(0) { }
 
 
 
-// SMELL: The algorithm is not clearly visible from here because it heavily relies on RequestGroups behaviour (sorting
-// chops backwards, etc.).
+// SMELL: The algorithm is not clearly visible from here because it heavily relies on RequestGroups behaviour (joining
+// of groups on top, popping of the smallest members first, etc.).
 void Requests::add(int offset) {
     if (!isInProgress()) {
-        myCurrentRequestGroup = RequestGroup{offset, offset};
-        readyToExecute(myCurrentRequestGroup);
+        auto requestGroup = RequestGroup{offset, offset};
+        myCurrentRequestGroups.push_back(requestGroup);
+        readyToExecute(requestGroup);
         return;
     }
-    if (myCurrentRequestGroup.isMember(offset))
+    if (std::any_of(myCurrentRequestGroups.begin(), myCurrentRequestGroups.end(),
+        [offset](const RequestGroup& rg) {return rg.isMember(offset);}))
     {
         return;
     }
@@ -49,6 +59,34 @@ void Requests::add(int offset) {
 
 
 
+void Requests::add(int offset, int count) {
+    if (count <= 0) {
+        return;
+    }
+    if (!isInProgress()) {
+        add(offset);
+        offset++;
+        count--;
+    }
+
+    if (count > 0) {
+        myRequestGroups->moveOnTop(RequestGroup{offset, offset + count - 1});
+        myLastEnqueuedOffset = offset + count - 1;
+
+        // requests which are being executed are not enqueued again
+        for (auto& currentRequestGroup: myCurrentRequestGroups) {
+            myRequestGroups->cut(currentRequestGroup);
+        }
+    }
+
+    // the first request may have been finished already by the consumer
+    if (!isInProgress()) {
+        executeReadyGroups();
+    }
+}
+
+
+
 void Requests::removeAll() {
     myRequestGroups->clear();
 }
@@ -58,17 +96,27 @@ void Requests::removeAll() {
 void Requests::setFinished(int offset, int count) {
     auto finishedRequestGroup = RequestGroup{offset, offset + count - 1};
 
+    // groups may finish in a different order than they were made ready to execution; the finished group is the one
+    // which contains the first finished request or the oldest one if there is no such group
+    RequestGroup currentRequestGroup{};
+    if (!myCurrentRequestGroups.empty()) {
+        auto currentRequestGroupIter = std::find_if(myCurrentRequestGroups.begin(), myCurrentRequestGroups.end(),
+            [offset](const RequestGroup& rg) {return rg.isMember(offset);});
+        if (finishedRequestGroup.isEmpty() || currentRequestGroupIter == myCurrentRequestGroups.end()) {
+            currentRequestGroupIter = myCurrentRequestGroups.begin();
+        }
+        currentRequestGroup = *currentRequestGroupIter;
+        myCurrentRequestGroups.erase(currentRequestGroupIter);
+    }
+
     // finished requests may be different from what was ready to execution; if there were some requests finished which
     // were not ready remainderGroups will contain them; they have to be cut from myRequestGroups
-    auto remainderGroups = finishedRequestGroup.substract(myCurrentRequestGroup);
+    auto remainderGroups = finishedRequestGroup.substract(currentRequestGroup);
     myRequestGroups->cut(remainderGroups.first);
     myRequestGroups->cut(remainderGroups.second);
 
-    if (!myRequestGroups->isEmpty()) {
-        myCurrentRequestGroup = myRequestGroups->pop();
-        readyToExecute(myCurrentRequestGroup);
-    } else {
-        myCurrentRequestGroup = RequestGroup{};
+    executeReadyGroups();
+    if (!isInProgress()) {
         myLastEnqueuedOffset = std::numeric_limits<int>::max();
     }
 }
@@ -76,7 +124,17 @@ void Requests::setFinished(int offset, int count) {
 
 
 bool Requests::isInProgress() const {
-    return !myCurrentRequestGroup.isEmpty();
+    return !myCurrentRequestGroups.empty();
+}
+
+
+
+void Requests::executeReadyGroups() {
+    while (static_cast<int>(myCurrentRequestGroups.size()) < myWindow && !myRequestGroups->isEmpty()) {
+        auto requestGroup = myRequestGroups->pop();
+        myCurrentRequestGroups.push_back(requestGroup);
+        readyToExecute(requestGroup);
+    }
 }
 
 }
@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <memory>
+#include <vector>
 #include "infrastructure/event/event.h"
 #include "request_group.h"
 #include "request_groups.h"
@@ -29,7 +30,8 @@ namespace application {
  * of a size specified as @p granularity parameter to constructor.  When enough requests are addded so that they form
  * a full group or no operation is currently being executed the event ::readyToExecute is fired.  Consumer should
  * execute whatever (asynchronous) operation for data mapped by the numbers in the ready group.  Once the operation
- * is finished the consumer has to call setFinished() method.
+ * is finished the consumer has to call setFinished() method.  Up to @p window groups can be executed at once; further
+ * groups are made ready as the executed ones finish.
  *
  * More recently an operation was added higher priority it gets.  Same operation can be added multiple times however
  * it will be executed only once (it affects only its priority).
@@ -44,6 +46,14 @@ public:
      */
     explicit Requests(int granularity);
 
+    /**
+     * @brief Constructor.
+     *
+     * @param granularity The maximal size of request group.  0 if unlimited.
+     * @param window The maximal number of request groups executed at once.
+     */
+    explicit Requests(int granularity, int window);
+
     /**
      * @brief Parameterless constructor.
      *
@@ -73,6 +83,17 @@ public:
      */
     void add(int offset);
 
+    /**
+     * @brief Adds a range of requests.
+     *
+     * Has the same effect as adding of each request of the range in the ascending order by add(int) however the
+     * range is enqueued at once.
+     *
+     * @param offset The first number of the range.
+     * @param count The number of requests in the range.
+     */
+    void add(int offset, int count);
+
     /**
      * @brief Remove all requests.
      *
@@ -106,11 +127,16 @@ private:
     // stores request groups
     const std::unique_ptr<RequestGroups> myRequestGroups;
 
-    // group that is currently being executed
-    RequestGroup myCurrentRequestGroup = RequestGroup{};
+    // maximal number of groups being executed at once
+    const int myWindow = 1;
+
+    // groups that are currently being executed, the oldest first
+    std::vector<RequestGroup> myCurrentRequestGroups;
 
     // operation number which was included into myRequestGroups most recently
     int myLastEnqueuedOffset = std::numeric_limits<int>::max();
+
+    void executeReadyGroups();
 };
 
 }
@@ -7,7 +7,9 @@
 
 
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include <Qt>
 #include <QtCore/QVariant>
@@ -37,20 +39,25 @@ using namespace domain;
 namespace application {
 
 TrackModel::TrackModel(data::TrackRepository* const trackRepository, QObject* parent): QAbstractTableModel(parent),
-myTrackRepository(trackRepository) {
+myTrackRepository(trackRepository),
+myRequests{new Requests{60, trackRepository->getLoadWindow()}},
+myRowCount{myTrackRepository->count()} {
     myRequests->readyToExecute += DELEGATE1(&TrackModel::onReadyToExecute, RequestGroup);
     myTrackRepository->loaded += DELEGATE1(&TrackModel::onLoaded, std::pair<int, int>);
-    myTrackRepository->dataSizeChanged += DELEGATE0(&TrackModel::onDataSizeOrFilterChanged);
-    myTrackRepository->filterChanged += DELEGATE0(&TrackModel::onDataSizeOrFilterChanged);
+    myTrackRepository->dataSizeChanged += DELEGATE0(&TrackModel::onDataSizeChanged);
+    myTrackRepository->filterChanged += DELEGATE0(&TrackModel::onFilterChanged);
     myTrackRepository->providerChanged += DELEGATE0(&TrackModel::onProviderChanged);
+    myTrackRepository->acknowledgeFilteredData();
+    myUpdateCoalescer->readyToApply += DELEGATE1(&TrackModel::onReadyToApply, ModelUpdate);
 }
 
 
 
 TrackModel::~TrackModel() {
+    myUpdateCoalescer->readyToApply -= DELEGATE1(&TrackModel::onReadyToApply, ModelUpdate);
     myTrackRepository->providerChanged -= DELEGATE0(&TrackModel::onProviderChanged);
-    myTrackRepository->filterChanged -= DELEGATE0(&TrackModel::onDataSizeOrFilterChanged);
-    myTrackRepository->dataSizeChanged -= DELEGATE0(&TrackModel::onDataSizeOrFilterChanged);
+    myTrackRepository->filterChanged -= DELEGATE0(&TrackModel::onFilterChanged);
+    myTrackRepository->dataSizeChanged -= DELEGATE0(&TrackModel::onDataSizeChanged);
     myTrackRepository->loaded -= DELEGATE1(&TrackModel::onLoaded, std::pair<int, int>);
     myRequests->readyToExecute -= DELEGATE1(&TrackModel::onReadyToExecute, RequestGroup);
 }
@@ -64,7 +71,9 @@ QVariant TrackModel::data(const QModelIndex& index, int role) const {
     int row = index.row();
     int column = index.column();
     if (!myTrackRepository->isLoaded(row)) {
-        if (role == Qt::DisplayRole && column == 0 && !myTrackRepository->isFiltered()) {
+        if (role == Qt::DisplayRole && column == 0 && !myTrackRepository->isFiltered() &&
+            row < myTrackRepository->count()) {
+
             myRequests->add(row);
         }
         return "...";
@@ -111,7 +120,7 @@ QVariant TrackModel::headerData(int section, Qt::Orientation, int role) const {
 
 
 int TrackModel::rowCount(const QModelIndex&) const {
-    return myTrackRepository->count();
+    return myRowCount;
 }
 
 
@@ -130,22 +139,96 @@ void TrackModel::onReadyToExecute(RequestGroup requestGroup) {
 
 void TrackModel::onLoaded(std::pair<int, int> offsetAndLimit) {
     myRequests->setFinished(offsetAndLimit.first, offsetAndLimit.second);
-    dataChanged(createIndex(offsetAndLimit.first, 0), createIndex(offsetAndLimit.first + offsetAndLimit.second - 1, 0));
+    myUpdateCoalescer->addChangedRows(offsetAndLimit.first, offsetAndLimit.second);
 }
 
 
 
-void TrackModel::onDataSizeOrFilterChanged() {
-    beginResetModel();
-    endResetModel();
+void TrackModel::onDataSizeChanged() {
+
+    // a filter reports changes of its data as a change of the data size
+    if (myTrackRepository->isFiltered()) {
+        myUpdateCoalescer->setResetNeeded();
+    } else {
+        myUpdateCoalescer->setSizeChanged();
+    }
+}
+
+
+
+void TrackModel::onFilterChanged() {
+    myUpdateCoalescer->setResetNeeded();
+}
+
+
+
+void TrackModel::onReadyToApply(ModelUpdate& modelUpdate) {
+    auto rowCount = myTrackRepository->count();
+    if (modelUpdate.isResetNeeded) {
+        std::vector<FilteredDataChange> changes;
+        if (!myTrackRepository->takeFilteredDataChanges(changes)) {
+            beginResetModel();
+            myRowCount = rowCount;
+            endResetModel();
+            return;
+        }
+
+        // only the removed and inserted rows are notified so that views keep their scroll position and selection
+        for (auto& change: changes) {
+            if (change.isInsertion) {
+                beginInsertRows(QModelIndex{}, change.offset, change.offset + change.count - 1);
+                myRowCount += change.count;
+                endInsertRows();
+            } else {
+                beginRemoveRows(QModelIndex{}, change.offset, change.offset + change.count - 1);
+                myRowCount -= change.count;
+                endRemoveRows();
+            }
+        }
+        return;
+    }
+
+    // while a filter is set every change of the filtered data needs a reset so the acknowledged ones are current;
+    // without it only the size of the filtered data is acknowledged
+    if (!myTrackRepository->isFiltered()) {
+        myTrackRepository->acknowledgeFilteredData();
+    }
+
+    // without a filter the data items are not reordered so only the rows at the end are inserted or removed
+    if (rowCount > myRowCount) {
+        beginInsertRows(QModelIndex{}, myRowCount, rowCount - 1);
+        myRowCount = rowCount;
+        endInsertRows();
+    } else if (rowCount < myRowCount) {
+        beginRemoveRows(QModelIndex{}, rowCount, myRowCount - 1);
+        myRowCount = rowCount;
+        endRemoveRows();
+    }
+
+    // the data size is changed also when deferred data items are linked so all rows are refreshed then
+    if (modelUpdate.isSizeChanged) {
+        if (myRowCount > 0) {
+            dataChanged(createIndex(0, 0), createIndex(myRowCount - 1, columnCount() - 1));
+        }
+        return;
+    }
+    for (auto& changedRows: modelUpdate.changedRows) {
+        auto lastRow = std::min(changedRows.second, myRowCount - 1);
+        if (changedRows.first <= lastRow) {
+            dataChanged(createIndex(changedRows.first, 0), createIndex(lastRow, 0));
+        }
+    }
 }
 
 
 
 void TrackModel::onProviderChanged() {
     beginResetModel();
+    myUpdateCoalescer->clear();
     myRequests->removeAll();
     requestAllData();
+    myRowCount = myTrackRepository->count();
+    myTrackRepository->acknowledgeFilteredData();
     endResetModel();
 }
 
@@ -153,9 +236,7 @@ void TrackModel::onProviderChanged() {
 
 void TrackModel::requestAllData() {
     LOG_DBG("Requesting all data.");
-    for (int row = 0; row < myTrackRepository->maxCount(); row++) {
-        myRequests->add(row);
-    }
+    myRequests->add(0, myTrackRepository->maxCount());
 }
 
 }
@@ -0,0 +1,120 @@
+// update_coalescer.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include <QObject>
+#include <QTimer>
+
+#include "update_coalescer.h"
+
+
+
+namespace application {
+
+// minimal interval between applications of changes (in milliseconds); roughly one display frame
+static const int FRAME_INTERVAL = 16;
+
+
+
+UpdateCoalescer::UpdateCoalescer(int interval):
+myTimer{new QTimer{}} {
+    myTimer->setSingleShot(true);
+    myTimer->setInterval(interval);
+    QObject::connect(myTimer.get(), &QTimer::timeout, [this]() {flush(); });
+}
+
+
+
+UpdateCoalescer::UpdateCoalescer(): UpdateCoalescer(FRAME_INTERVAL) { }
+
+
+
+UpdateCoalescer::~UpdateCoalescer() { }
+
+
+
+void UpdateCoalescer::addChangedRows(int offset, int count) {
+    if (count <= 0) {
+        return;
+    }
+    schedule();
+    if (myIsResetNeeded) {
+        return;
+    }
+
+    // the new range is merged with all ranges it overlaps or adjoins
+    auto first = offset;
+    auto last = offset + count - 1;
+    auto changedRowsIter = myChangedRows.upper_bound(first);
+    if (changedRowsIter != myChangedRows.begin() && std::prev(changedRowsIter)->second + 1 >= first) {
+        --changedRowsIter;
+        first = changedRowsIter->first;
+    }
+    while (changedRowsIter != myChangedRows.end() && changedRowsIter->first <= last + 1) {
+        last = std::max(last, changedRowsIter->second);
+        changedRowsIter = myChangedRows.erase(changedRowsIter);
+    }
+    myChangedRows[first] = last;
+}
+
+
+
+void UpdateCoalescer::setSizeChanged() {
+    myIsSizeChanged = true;
+    schedule();
+}
+
+
+
+void UpdateCoalescer::setResetNeeded() {
+    myIsResetNeeded = true;
+    myChangedRows.clear();
+    schedule();
+}
+
+
+
+void UpdateCoalescer::clear() {
+    myTimer->stop();
+    myIsResetNeeded = false;
+    myIsSizeChanged = false;
+    myChangedRows.clear();
+}
+
+
+
+void UpdateCoalescer::flush() {
+    myTimer->stop();
+    if (!myIsResetNeeded && !myIsSizeChanged && myChangedRows.empty()) {
+        return;
+    }
+
+    ModelUpdate modelUpdate;
+    modelUpdate.isResetNeeded = myIsResetNeeded;
+    modelUpdate.isSizeChanged = myIsSizeChanged;
+    modelUpdate.changedRows.assign(myChangedRows.begin(), myChangedRows.end());
+
+    // changes made by consumers of the event are accumulated for the next frame
+    clear();
+    readyToApply(modelUpdate);
+}
+
+
+
+void UpdateCoalescer::schedule() {
+    if (!myTimer->isActive()) {
+        myTimer->start();
+    }
+}
+
+}
@@ -0,0 +1,137 @@
+// update_coalescer.h
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#ifndef UPDATECOALESCER_H
+#define UPDATECOALESCER_H
+
+
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "infrastructure/event/event.h"
+
+class QTimer;
+
+
+
+namespace application {
+
+/**
+ * @brief Changes of a model accumulated within one display frame.
+ */
+struct ModelUpdate {
+
+    /**
+     * @brief The data were changed arbitrarily (e.g. by a filter) so the whole model has to be refreshed.
+     */
+    bool isResetNeeded = false;
+
+    /**
+     * @brief The number of data items was changed.
+     */
+    bool isSizeChanged = false;
+
+    /**
+     * @brief Sorted disjoint ranges of rows (first and last row) which were loaded.
+     */
+    std::vector<std::pair<int, int>> changedRows;
+};
+
+
+
+/**
+ * @brief Coalesces changes of a model so that they are applied to views at most once per display frame.
+ *
+ * While data are being loaded repositories and filters report changes for each loaded page.  Changes reported by
+ * addChangedRows(), setSizeChanged() and setResetNeeded() are accumulated and once per frame ::readyToApply is fired
+ * with all of them.  Adjacent and overlapping changed rows are merged into ranges so that they can be notified at once.
+ */
+class UpdateCoalescer {
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param interval The minimal interval between two ::readyToApply events (in milliseconds).
+     */
+    explicit UpdateCoalescer(int interval);
+
+    /**
+     * @brief Constructor.
+     *
+     * Changes are applied at most once per 1/60 of a second.
+     */
+    explicit UpdateCoalescer();
+
+    ~UpdateCoalescer();
+
+    UpdateCoalescer(const UpdateCoalescer& other) = delete;
+
+    UpdateCoalescer& operator=(const UpdateCoalescer& other) = delete;
+
+    /**
+     * @brief Accumulated changes are ready to be applied.
+     *
+     * Consumer should notify views about the changes.
+     */
+    infrastructure::Event<ModelUpdate> readyToApply{};
+
+    /**
+     * @brief Adds rows which were loaded.
+     *
+     * @param offset The first loaded row.
+     * @param count The number of loaded rows.
+     */
+    void addChangedRows(int offset, int count);
+
+    /**
+     * @brief Reports that the number of data items was changed.
+     */
+    void setSizeChanged();
+
+    /**
+     * @brief Reports that the data were changed so that the whole model has to be refreshed.
+     *
+     * Changed rows which are pending are discarded since they are covered by the refresh.
+     */
+    void setResetNeeded();
+
+    /**
+     * @brief Discards all pending changes.
+     *
+     * Should be called when the consumer refreshes the whole model by itself.
+     */
+    void clear();
+
+    /**
+     * @brief Fires ::readyToApply with pending changes immediately.
+     *
+     * Does nothing if there are no pending changes.
+     */
+    void flush();
+
+private:
+    // fires the accumulated changes once the interval elapses
+    const std::unique_ptr<QTimer> myTimer;
+
+    // pending changes; changed rows are stored in a map from the first to the last row of each range
+    bool myIsResetNeeded = false;
+    bool myIsSizeChanged = false;
+    std::map<int, int> myChangedRows;
+
+    void schedule();
+};
+
+}
+
+
+
+#endif // UPDATECOALESCER_H
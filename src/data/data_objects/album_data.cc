@@ -20,31 +20,35 @@ using namespace domain;
 
 namespace data {
 
-AlbumData::AlbumData(const std::string& id, const std::string& artUrl, const std::string& artistId, int numberOfTracks,
+const std::string AlbumData::NO_ARTIST_ID = "0";
+
+
+
+AlbumData::AlbumData(const std::string& id, const std::string& artUrl, int artistIdHandle, int numberOfTracks,
     std::unique_ptr<Album> album):
 myId{id},
 myArtUrl{artUrl},
-myArtistId{artistId},
+myArtistIdHandle{artistIdHandle},
 myNumberOfTracks{numberOfTracks},
 myAlbum{std::move(album)} {
 }
 
 
 
-std::string AlbumData::getId() const {
+const std::string& AlbumData::getId() const {
     return myId;
 }
 
 
 
-std::string AlbumData::getArtUrl() const {
+const std::string& AlbumData::getArtUrl() const {
     return myArtUrl;
 }
 
 
 
-std::string AlbumData::getArtistId() const {
-    return myArtistId;
+int AlbumData::getArtistIdHandle() const {
+    return myArtistIdHandle;
 }
 
 
@@ -62,7 +66,7 @@ Album& AlbumData::getAlbum() const {
 
 
 bool AlbumData::hasArtist() const {
-    return myArtistId != "0";
+    return myArtistIdHandle != NO_ARTIST_ID_HANDLE;
 }
 
 
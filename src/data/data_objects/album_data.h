@@ -28,17 +28,29 @@ namespace data {
 class AlbumData {
 
 public:
+    /**
+     * @brief Identifier of the artist of albums which do not have any.
+     *
+     * Interners of artist IDs reserve handle NO_ARTIST_ID_HANDLE for it (see IdInterner::IdInterner()).
+     */
+    static const std::string NO_ARTIST_ID;
+
+    /**
+     * @brief Handle of NO_ARTIST_ID.
+     */
+    static const int NO_ARTIST_ID_HANDLE = 0;
+
     /**
      * @brief Constructor.
      *
      * @param id Identifier.
      * @param artUrl URL of the album art.
-     * @param artistId ID of album's artist.
+     * @param artistIdHandle Handle of the ID of album's artist interned by the interner of artist IDs.
      * @param numberOfTracks
      * @param album Album domain object.
      */
-    explicit AlbumData(const std::string& id, const std::string& artUrl, const std::string& artistId,
-        int numberOfTracks, std::unique_ptr<domain::Album> album);
+    explicit AlbumData(const std::string& id, const std::string& artUrl, int artistIdHandle, int numberOfTracks,
+        std::unique_ptr<domain::Album> album);
 
     AlbumData(const AlbumData& other) = delete;
 
@@ -49,21 +61,21 @@ public:
      *
      * @return std::string
      */
-    std::string getId() const;
+    const std::string& getId() const;
 
     /**
      * @brief Gets URL of the album art.
      *
      * @return std::string
      */
-    std::string getArtUrl() const;
+    const std::string& getArtUrl() const;
 
     /**
-     * @brief Gets the identifier of album's artist.
+     * @brief Gets the handle of the identifier of album's artist.
      *
-     * @return std::string
+     * @sa IdInterner::getId()
      */
-    std::string getArtistId() const;
+    int getArtistIdHandle() const;
 
     /**
      * @brief Gets number of tracks on the album.
@@ -90,7 +102,7 @@ private:
     // arguments from the constructor
     const std::string myId;
     const std::string myArtUrl;
-    const std::string myArtistId;
+    const int myArtistIdHandle;
     const int myNumberOfTracks;
     const std::unique_ptr<domain::Album> myAlbum;
 };
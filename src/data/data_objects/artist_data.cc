@@ -29,7 +29,7 @@ myArtist{std::move(artist)} {
 
 
 
-std::string ArtistData::getId() const {
+const std::string& ArtistData::getId() const {
     return myId;
 }
 
@@ -48,7 +48,7 @@ public:
      *
      * @return std::string
      */
-    std::string getId() const;
+    const std::string& getId() const;
 
     /**
      * @brief Gets number of artist's albums.
@@ -7,9 +7,7 @@
 
 
 
-#include <utility>
 #include <string>
-#include <memory>
 
 #include "domain/track.h"
 #include "track_data.h"
@@ -21,41 +19,44 @@ using namespace domain;
 namespace data {
 
 bool TrackData::NameCompare::operator()(const TrackData& lhs, const TrackData& rhs) const {
-    return lhs.getTrack().getName() < rhs.getTrack().getName();
+    auto& lhsName = lhs.getTrack().getName();
+    auto& rhsName = rhs.getTrack().getName();
+
+    // tracks with the same name are ordered by the default order so that they are not equivalent
+    return lhsName != rhsName ? lhsName < rhsName : lhs < rhs;
 }
 
 
 
-TrackData::TrackData(
-    const std::string& id, const std::string& artistId, const std::string& albumId, std::unique_ptr<Track> track):
-myId{id},
-myArtistId{artistId},
-myAlbumId{albumId},
-myTrack{std::move(track)} {
+TrackData::TrackData(const std::string& id, int artistIdHandle, int albumIdHandle, const std::string& name,
+    const std::string& disk, int number, const std::string& url):
+myArtistIdHandle{artistIdHandle},
+myAlbumIdHandle{albumIdHandle},
+myTrack{id, name, disk, number, url} {
 }
 
 
 
-std::string TrackData::getId() const {
-    return myId;
+const std::string& TrackData::getId() const {
+    return myTrack.getId();
 }
 
 
 
-std::string TrackData::getArtistId() const {
-    return myArtistId;
+int TrackData::getArtistIdHandle() const {
+    return myArtistIdHandle;
 }
 
 
 
-std::string TrackData::getAlbumId() const {
-    return myAlbumId;
+int TrackData::getAlbumIdHandle() const {
+    return myAlbumIdHandle;
 }
 
 
 
 Track& TrackData::getTrack() const {
-    return *myTrack;
+    return myTrack;
 }
 
 
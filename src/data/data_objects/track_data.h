@@ -14,7 +14,6 @@
 
 #include <cstddef>
 #include <string>
-#include <memory>
 
 #include "domain/track.h"
 
@@ -24,6 +23,9 @@ namespace data {
 
 /**
  * @brief Track data read from an external source (such as Ampache server).
+ *
+ * The track domain object is part of the data so that each track needs a single allocation; the identifier is shared
+ * with it.  Identifiers of the artist and album are interned.
  */
 class TrackData {
 
@@ -40,12 +42,15 @@ public:
      * @brief Constructor.
      *
      * @param id Identifier.
-     * @param artistId ID of track's artist.
-     * @param albumId ID of tracks's album.
-     * @param track Track domain object.
+     * @param artistIdHandle Handle of the ID of track's artist interned by the interner of artist IDs.
+     * @param albumIdHandle Handle of the ID of tracks's album interned by the interner of album IDs.
+     * @param name Track name/title.
+     * @param disk Disk of the track (see domain::Track::getDisk()).
+     * @param number Number under which the track is listed on the album.
+     * @param url URL to media file with recording of the track.
      */
-    explicit TrackData(const std::string& id, const std::string& artistId, const std::string& albumId,
-        std::unique_ptr<domain::Track> track);
+    explicit TrackData(const std::string& id, int artistIdHandle, int albumIdHandle, const std::string& name,
+        const std::string& disk, int number, const std::string& url);
 
     TrackData(const TrackData& other) = delete;
 
@@ -54,23 +59,23 @@ public:
     /**
      * @brief Gets the identifier.
      *
-     * @return std::string
+     * @return const std::string&
      */
-    std::string getId() const;
+    const std::string& getId() const;
 
     /**
-     * @brief Gets the identifier of track's artist.
+     * @brief Gets the handle of the identifier of track's artist.
      *
-     * @return std::string
+     * @sa IdInterner::getId()
      */
-    std::string getArtistId() const;
+    int getArtistIdHandle() const;
 
     /**
-     * @brief Gets the identifier of track's album.
+     * @brief Gets the handle of the identifier of track's album.
      *
-     * @return std::string
+     * @sa IdInterner::getId()
      */
-    std::string getAlbumId() const;
+    int getAlbumIdHandle() const;
 
     /**
      * @brief Gets the track domain object.
@@ -80,11 +85,12 @@ public:
     domain::Track& getTrack() const;
 
 private:
-    // arguments from the constructor
-    const std::string myId;
-    const std::string myArtistId;
-    const std::string myAlbumId;
-    const std::unique_ptr<domain::Track> myTrack;
+    // interned arguments from the constructor; the same IDs are shared by many tracks
+    const int myArtistIdHandle;
+    const int myAlbumIdHandle;
+
+    // the domain object is modified by linking even if the data are const
+    mutable domain::Track myTrack;
 };
 
 bool operator==(const TrackData& lhs, const TrackData& rhs);
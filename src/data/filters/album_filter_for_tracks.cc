@@ -8,7 +8,6 @@
 
 
 #include <vector>
-#include <set>
 #include <memory>
 #include <algorithm>
 #include <functional>
@@ -18,6 +17,7 @@
 #include "../data_objects/track_data.h"
 #include "data/indices.h"
 #include "data/filters/filter.h"
+#include "data/filters/sorted_lists_merger.h"
 #include "data/filters/album_filter_for_tracks.h"
 
 using namespace infrastructure;
@@ -29,18 +29,18 @@ namespace data {
 
 AlbumFilterForTracks::AlbumFilterForTracks(const std::vector<std::reference_wrapper<const Album>>& albums,
     Indices& indices): Filter<TrackData>(),
-myAlbums(albums),
 myIndices(indices) {
+    for (auto& album: albums) {
+        myAlbumIdHandles.push_back(myIndices.getAlbumIdHandle(album));
+    }
     processUpdatedIndices();
-    myIndices.albumTracksUpdated += DELEGATE1(&AlbumFilterForTracks::onAlbumTracksUpdated,
-        std::vector<std::reference_wrapper<const Album>>);
+    myIndices.albumTracksUpdated += DELEGATE1(&AlbumFilterForTracks::onAlbumTracksUpdated, std::vector<int>);
 }
 
 
 
 AlbumFilterForTracks::~AlbumFilterForTracks() {
-    myIndices.albumTracksUpdated -= DELEGATE1(&AlbumFilterForTracks::onAlbumTracksUpdated,
-        std::vector<std::reference_wrapper<const Album>>);
+    myIndices.albumTracksUpdated -= DELEGATE1(&AlbumFilterForTracks::onAlbumTracksUpdated, std::vector<int>);
 }
 
 
@@ -57,9 +57,16 @@ void AlbumFilterForTracks::processUpdatedSourceData(int, int) {
 
 
 
-void AlbumFilterForTracks::onAlbumTracksUpdated(const std::vector<std::reference_wrapper<const Album>>& updatedAlbums) {
-    auto albumsIter = find_first_of(myAlbums.begin(), myAlbums.end(), updatedAlbums.begin(), updatedAlbums.end());
-    if (albumsIter != myAlbums.end()) {
+AlbumFilterForTracks::Order AlbumFilterForTracks::getOrder() const {
+    return &Indices::isAlbumTrackBefore;
+}
+
+
+
+void AlbumFilterForTracks::onAlbumTracksUpdated(const std::vector<int>& updatedAlbums) {
+    auto albumIdHandlesIter = find_first_of(myAlbumIdHandles.begin(), myAlbumIdHandles.end(), updatedAlbums.begin(),
+        updatedAlbums.end());
+    if (albumIdHandlesIter != myAlbumIdHandles.end()) {
         processUpdatedIndices();
         changed();
     }
@@ -68,15 +75,11 @@ void AlbumFilterForTracks::onAlbumTracksUpdated(const std::vector<std::reference
 
 
 void AlbumFilterForTracks::processUpdatedIndices() {
-    myFilteredData.clear();
-    std::set<std::reference_wrapper<TrackData>> filteredUniqueTrackData;
-    for (auto& album: myAlbums) {
-        auto tracksData = myIndices.getAlbumTracks(album.get());
-        filteredUniqueTrackData.insert(tracksData.begin(), tracksData.end());
-    }
-    for (auto& trackData: filteredUniqueTrackData) {
-        myFilteredData.push_back(&trackData.get());
+    std::vector<const std::vector<TrackData*>*> tracksData;
+    for (auto albumIdHandle: myAlbumIdHandles) {
+        tracksData.push_back(&myIndices.getAlbumTracks(albumIdHandle));
     }
+    SortedListsMerger<TrackData>::merge(tracksData, &Indices::isAlbumTrackBefore, myFilteredData);
 }
 
 }
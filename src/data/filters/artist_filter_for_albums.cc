@@ -8,7 +8,6 @@
 
 
 #include <vector>
-#include <set>
 #include <memory>
 #include <algorithm>
 #include <functional>
@@ -18,6 +17,7 @@
 #include "../data_objects/album_data.h"
 #include "data/indices.h"
 #include "data/filters/filter.h"
+#include "data/filters/sorted_lists_merger.h"
 #include "data/filters/artist_filter_for_albums.h"
 
 using namespace infrastructure;
@@ -29,18 +29,18 @@ namespace data {
 
 ArtistFilterForAlbums::ArtistFilterForAlbums(const std::vector<std::reference_wrapper<const Artist>>& artists,
     Indices& indices): Filter<AlbumData>(),
-myArtists(artists),
 myIndices(indices) {
+    for (auto& artist: artists) {
+        myArtistIdHandles.push_back(myIndices.getArtistIdHandle(artist));
+    }
     processUpdatedIndices();
-    myIndices.artistAlbumsUpdated += DELEGATE1(&ArtistFilterForAlbums::onArtistAlbumsUpdated,
-        std::vector<std::reference_wrapper<const Artist>>);
+    myIndices.artistAlbumsUpdated += DELEGATE1(&ArtistFilterForAlbums::onArtistAlbumsUpdated, std::vector<int>);
 }
 
 
 
 ArtistFilterForAlbums::~ArtistFilterForAlbums() {
-    myIndices.artistAlbumsUpdated -= DELEGATE1(&ArtistFilterForAlbums::onArtistAlbumsUpdated,
-        std::vector<std::reference_wrapper<const Artist>>);
+    myIndices.artistAlbumsUpdated -= DELEGATE1(&ArtistFilterForAlbums::onArtistAlbumsUpdated, std::vector<int>);
 }
 
 
@@ -56,11 +56,16 @@ void ArtistFilterForAlbums::processUpdatedSourceData(int, int) {
 
 
 
-void ArtistFilterForAlbums::onArtistAlbumsUpdated(
-    const std::vector<std::reference_wrapper<const Artist>>& updatedArtists) {
+ArtistFilterForAlbums::Order ArtistFilterForAlbums::getOrder() const {
+    return &Indices::isArtistAlbumBefore;
+}
+
+
 
-    auto artistsIter = find_first_of(myArtists.begin(), myArtists.end(), updatedArtists.begin(), updatedArtists.end());
-    if (artistsIter != myArtists.end()) {
+void ArtistFilterForAlbums::onArtistAlbumsUpdated(const std::vector<int>& updatedArtists) {
+    auto artistIdHandlesIter = find_first_of(myArtistIdHandles.begin(), myArtistIdHandles.end(), updatedArtists.begin(),
+        updatedArtists.end());
+    if (artistIdHandlesIter != myArtistIdHandles.end()) {
         processUpdatedIndices();
         changed();
     }
@@ -69,16 +74,11 @@ void ArtistFilterForAlbums::onArtistAlbumsUpdated(
 
 
 void ArtistFilterForAlbums::processUpdatedIndices() {
-    myFilteredData.clear();
-    std::set<std::reference_wrapper<AlbumData>> filteredUniqueAlbumData;
-
-    for (auto& artist: myArtists) {
-        auto albumsData = myIndices.getArtistAlbums(artist.get());
-        filteredUniqueAlbumData.insert(albumsData.begin(), albumsData.end());
-    }
-    for (auto& albumData: filteredUniqueAlbumData) {
-        myFilteredData.push_back(&albumData.get());
+    std::vector<const std::vector<AlbumData*>*> albumsData;
+    for (auto artistIdHandle: myArtistIdHandles) {
+        albumsData.push_back(&myIndices.getArtistAlbums(artistIdHandle));
     }
+    SortedListsMerger<AlbumData>::merge(albumsData, &Indices::isArtistAlbumBefore, myFilteredData);
 }
 
 }
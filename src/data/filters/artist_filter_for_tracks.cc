@@ -8,7 +8,6 @@
 
 
 #include <vector>
-#include <set>
 #include <memory>
 #include <algorithm>
 #include <functional>
@@ -18,6 +17,7 @@
 #include "../data_objects/track_data.h"
 #include "data/indices.h"
 #include "data/filters/filter.h"
+#include "data/filters/sorted_lists_merger.h"
 #include "data/filters/artist_filter_for_tracks.h"
 
 using namespace infrastructure;
@@ -29,18 +29,18 @@ namespace data {
 
 ArtistFilterForTracks::ArtistFilterForTracks(const std::vector<std::reference_wrapper<const Artist>>& artists,
     Indices& indices): Filter<TrackData>(),
-myArtists(artists),
 myIndices(indices) {
+    for (auto& artist: artists) {
+        myArtistIdHandles.push_back(myIndices.getArtistIdHandle(artist));
+    }
     processUpdatedIndices();
-    myIndices.artistTracksUpdated += DELEGATE1(&ArtistFilterForTracks::onArtistTracksUpdated,
-        std::vector<std::reference_wrapper<const Artist>>);
+    myIndices.artistTracksUpdated += DELEGATE1(&ArtistFilterForTracks::onArtistTracksUpdated, std::vector<int>);
 }
 
 
 
 ArtistFilterForTracks::~ArtistFilterForTracks() {
-    myIndices.artistTracksUpdated -= DELEGATE1(&ArtistFilterForTracks::onArtistTracksUpdated,
-        std::vector<std::reference_wrapper<const Artist>>);
+    myIndices.artistTracksUpdated -= DELEGATE1(&ArtistFilterForTracks::onArtistTracksUpdated, std::vector<int>);
 }
 
 
@@ -57,11 +57,16 @@ void ArtistFilterForTracks::processUpdatedSourceData(int, int) {
 
 
 
-void ArtistFilterForTracks::onArtistTracksUpdated(
-    const std::vector<std::reference_wrapper<const Artist>>& updatedArtists) {
+ArtistFilterForTracks::Order ArtistFilterForTracks::getOrder() const {
+    return &Indices::isArtistTrackBefore;
+}
+
 
-    auto artistsIter = find_first_of(myArtists.begin(), myArtists.end(), updatedArtists.begin(), updatedArtists.end());
-    if (artistsIter != myArtists.end()) {
+
+void ArtistFilterForTracks::onArtistTracksUpdated(const std::vector<int>& updatedArtists) {
+    auto artistIdHandlesIter = find_first_of(myArtistIdHandles.begin(), myArtistIdHandles.end(), updatedArtists.begin(),
+        updatedArtists.end());
+    if (artistIdHandlesIter != myArtistIdHandles.end()) {
         processUpdatedIndices();
         changed();
     }
@@ -70,15 +75,11 @@ void ArtistFilterForTracks::onArtistTracksUpdated(
 
 
 void ArtistFilterForTracks::processUpdatedIndices() {
-    myFilteredData.clear();
-    std::set<std::reference_wrapper<TrackData>, TrackData::NameCompare> filteredUniqueTrackData;
-    for (auto& artist: myArtists) {
-        auto tracksData = myIndices.getArtistTracks(artist.get());
-        filteredUniqueTrackData.insert(tracksData.begin(), tracksData.end());
-    }
-    for (auto& trackData: filteredUniqueTrackData) {
-        myFilteredData.push_back(&trackData.get());
+    std::vector<const std::vector<TrackData*>*> tracksData;
+    for (auto artistIdHandle: myArtistIdHandles) {
+        tracksData.push_back(&myIndices.getArtistTracks(artistIdHandle));
     }
+    SortedListsMerger<TrackData>::merge(tracksData, &Indices::isArtistTrackBefore, myFilteredData);
 }
 
 }
@@ -9,6 +9,7 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
 
 
 
@@ -46,4 +47,115 @@ const std::vector<T*>& Filter<T>::getFilteredData() const {
     return myFilteredData;
 }
 
+
+
+template <typename T>
+void Filter<T>::takeSnapshot(FilteredDataSnapshot<T>& snapshot) const {
+    snapshot.order = getOrder();
+    snapshot.size = myFilteredData.size();
+    auto filteredOffsets = getFilteredOffsets();
+    if (snapshot.order == nullptr && filteredOffsets != nullptr) {
+        snapshot.offsets = *filteredOffsets;
+    } else {
+        std::vector<int>{}.swap(snapshot.offsets);
+    }
+    if (snapshot.order != nullptr) {
+        snapshot.dataItems = myFilteredData;
+    } else {
+        std::vector<T*>{}.swap(snapshot.dataItems);
+    }
+}
+
+
+
+// computes changes which transform the previous data to the current ones by merging them; both data have to be ordered
+// by isBefore which is verified during the merge and equal data items have to have equal keys
+template <typename P, typename C, typename B>
+static bool mergeChanges(int previousSize, const P& getPreviousKey, int size, const C& getKey, const B& isBefore,
+    std::vector<FilteredDataChange>& changes) {
+
+    auto addChange = [&changes](bool isInsertion, int offset) {
+        if (!changes.empty() && changes.back().isInsertion == isInsertion &&
+            changes.back().offset + (isInsertion ? changes.back().count : 0) == offset) {
+
+            changes.back().count++;
+        } else {
+            changes.push_back(FilteredDataChange{isInsertion, offset, 1});
+        }
+    };
+    auto isOrdered = [&isBefore](const auto& getKeyAt, int idx) {
+        return idx == 0 || isBefore(getKeyAt(idx - 1), getKeyAt(idx));
+    };
+
+    // offset in the filtered data with the changes found so far applied
+    int offset = 0;
+    int previousIdx = 0;
+    int idx = 0;
+    while (previousIdx < previousSize || idx < size) {
+        if ((previousIdx < previousSize && !isOrdered(getPreviousKey, previousIdx)) ||
+            (idx < size && !isOrdered(getKey, idx))) {
+
+            return false;
+        }
+
+        if (idx == size || (previousIdx < previousSize && isBefore(getPreviousKey(previousIdx), getKey(idx)))) {
+            addChange(false, offset);
+            previousIdx++;
+        } else if (previousIdx == previousSize || isBefore(getKey(idx), getPreviousKey(previousIdx))) {
+            addChange(true, offset);
+            idx++;
+            offset++;
+        } else if (getPreviousKey(previousIdx) == getKey(idx)) {
+            previousIdx++;
+            idx++;
+            offset++;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+template <typename T>
+bool Filter<T>::getChangesSince(const FilteredDataSnapshot<T>& snapshot,
+    std::vector<FilteredDataChange>& changes) const {
+
+    changes.clear();
+    auto order = getOrder();
+    if (order != snapshot.order) {
+        return false;
+    }
+    int size = myFilteredData.size();
+
+    // data items ordered by the filter are compared directly
+    if (order != nullptr) {
+        return mergeChanges(snapshot.size, [&snapshot](int idx) -> const T* {return snapshot.dataItems[idx]; }, size,
+            [this](int idx) -> const T* {return myFilteredData[idx]; }, order, changes);
+    }
+
+    // data items in the order of the source data are compared by their offsets in them
+    auto filteredOffsets = getFilteredOffsets();
+    return mergeChanges(snapshot.size, [&snapshot](int idx) {
+        return snapshot.offsets.empty() ? idx : snapshot.offsets[idx];
+    }, size, [filteredOffsets](int idx) {
+        return filteredOffsets == nullptr ? idx : (*filteredOffsets)[idx];
+    }, std::less<int>{}, changes);
+}
+
+
+
+template <typename T>
+typename Filter<T>::Order Filter<T>::getOrder() const {
+    return nullptr;
+}
+
+
+
+template <typename T>
+const std::vector<int>* Filter<T>::getFilteredOffsets() const {
+    return nullptr;
+}
+
 }
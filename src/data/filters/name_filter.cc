@@ -0,0 +1,196 @@
+// name_filter.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <algorithm>
+
+#include "data/name_index.h"
+#include "data/filters/filter.h"
+#include "data/filters/name_matcher.h"
+
+
+
+namespace data {
+
+template <typename T>
+NameFilter<T>::NameFilter(const std::string& namePattern, const NameIndex& nameIndex,
+    const NameFilter<T>* previousFilter): Filter<T>(),
+myNamePattern(namePattern),
+myNameIndex(nameIndex),
+myFoldedNamePattern(nameIndex.fold(namePattern)) {
+    if (previousFilter != nullptr && isRefining(myFoldedNamePattern, *previousFilter)) {
+        setFilteredData(NameMatcher<T>::match(myFoldedNamePattern,
+            createCandidates(previousFilter->getFilteredDataItems(), myNameIndex)));
+        myIsPrecomputed = true;
+    }
+}
+
+
+
+template <typename T>
+NameFilter<T>::NameFilter(const std::string& namePattern, const NameIndex& nameIndex,
+    const DataItems& filteredData): Filter<T>(),
+myNamePattern(namePattern),
+myNameIndex(nameIndex),
+myFoldedNamePattern(nameIndex.fold(namePattern)) {
+    setFilteredData(filteredData);
+    myIsPrecomputed = true;
+}
+
+
+
+template <typename T>
+void NameFilter<T>::processUpdatedSourceData(int offset, int length) {
+    if (myIsPrecomputed) {
+        myIsPrecomputed = false;
+    } else if (offset == -1) {
+        setFilteredData(NameMatcher<T>::match(myFoldedNamePattern,
+            selectCandidates(myNamePattern, myNameIndex, *this->mySourceData)));
+    } else {
+        updateFilteredData(offset, length);
+    }
+
+    Filter<T>::processUpdatedSourceData(offset, length);
+}
+
+
+
+template <typename T>
+const std::vector<int>* NameFilter<T>::getFilteredOffsets() const {
+    return &myFilteredOffsets;
+}
+
+
+
+template <typename T>
+typename NameFilter<T>::Candidates NameFilter<T>::selectCandidates(const std::string& namePattern,
+    const NameIndex& nameIndex, const std::vector<std::unique_ptr<T>>& sourceData,
+    const NameFilter<T>* previousFilter) {
+
+    auto foldedNamePattern = nameIndex.fold(namePattern);
+    if (previousFilter != nullptr && isRefining(foldedNamePattern, *previousFilter)) {
+        return createCandidates(previousFilter->getFilteredDataItems(), nameIndex);
+    }
+
+    Candidates candidates;
+    std::vector<int> offsets;
+    if (nameIndex.findCandidates(foldedNamePattern, offsets)) {
+        for (auto offset: offsets) {
+            auto& dataItem = sourceData[offset];
+            if (dataItem != nullptr) {
+                candidates.push_back({offset, dataItem.get(), nameIndex.getFoldedName(offset)});
+            }
+        }
+    } else {
+        for (unsigned int offset = 0; offset < sourceData.size(); offset++) {
+            auto& dataItem = sourceData[offset];
+            if (dataItem != nullptr) {
+                candidates.push_back({static_cast<int>(offset), dataItem.get(), nameIndex.getFoldedName(offset)});
+            }
+        }
+    }
+    return candidates;
+}
+
+
+
+template <typename T>
+typename NameFilter<T>::DataItems NameFilter<T>::matchCandidates(const std::string& namePattern,
+    const NameIndex& nameIndex, const Candidates& candidates, const std::function<bool()>& isCancelled) {
+
+    return NameMatcher<T>::match(nameIndex.fold(namePattern), candidates, isCancelled);
+}
+
+
+
+template <typename T>
+typename NameFilter<T>::Candidates NameFilter<T>::createCandidates(const DataItems& dataItems,
+    const NameIndex& nameIndex) {
+
+    Candidates candidates;
+    candidates.reserve(dataItems.size());
+    for (auto& offsetAndData: dataItems) {
+        auto offset = offsetAndData.first;
+        candidates.push_back({offset, offsetAndData.second, nameIndex.getFoldedName(offset)});
+    }
+    return candidates;
+}
+
+
+
+template <typename T>
+bool NameFilter<T>::isRefining(const std::string& foldedNamePattern, const NameFilter<T>& previousFilter) {
+
+    // names matching the pattern are subset of names matching the previous pattern if it is contained in the pattern
+    return foldedNamePattern.find(previousFilter.myFoldedNamePattern) != std::string::npos;
+}
+
+
+
+template <typename T>
+typename NameFilter<T>::DataItems NameFilter<T>::getFilteredDataItems() const {
+    DataItems filteredDataItems;
+    filteredDataItems.reserve(this->myFilteredData.size());
+    for (unsigned int idx = 0; idx < this->myFilteredData.size(); idx++) {
+        filteredDataItems.emplace_back(myFilteredOffsets[idx], this->myFilteredData[idx]);
+    }
+    return filteredDataItems;
+}
+
+
+
+template <typename T>
+void NameFilter<T>::setFilteredData(const DataItems& filteredData) {
+    this->myFilteredData.clear();
+    myFilteredOffsets.clear();
+    this->myFilteredData.reserve(filteredData.size());
+    myFilteredOffsets.reserve(filteredData.size());
+    for (auto& offsetAndData: filteredData) {
+        myFilteredOffsets.push_back(offsetAndData.first);
+        this->myFilteredData.push_back(offsetAndData.second);
+    }
+}
+
+
+
+template <typename T>
+void NameFilter<T>::updateFilteredData(int offset, int length) {
+    Candidates candidates;
+    for (auto idx = offset; idx < offset + length; idx++) {
+        auto& dataItem = (*this->mySourceData)[idx];
+        if (dataItem != nullptr) {
+            candidates.push_back({idx, dataItem.get(), myNameIndex.getFoldedName(idx)});
+        }
+    }
+    auto matchingData = NameMatcher<T>::match(myFoldedNamePattern, candidates);
+
+    // replace the result in the updated range; it is usually empty and at the end since data are loaded in order
+    auto beginIter = std::lower_bound(myFilteredOffsets.begin(), myFilteredOffsets.end(), offset);
+    auto endIter = std::lower_bound(beginIter, myFilteredOffsets.end(), offset + length);
+    auto beginIdx = beginIter - myFilteredOffsets.begin();
+    auto endIdx = endIter - myFilteredOffsets.begin();
+    myFilteredOffsets.erase(beginIter, endIter);
+    this->myFilteredData.erase(this->myFilteredData.begin() + beginIdx, this->myFilteredData.begin() + endIdx);
+
+    std::vector<int> matchingOffsets;
+    std::vector<T*> matchingDataItems;
+    for (auto& offsetAndData: matchingData) {
+        matchingOffsets.push_back(offsetAndData.first);
+        matchingDataItems.push_back(offsetAndData.second);
+    }
+    myFilteredOffsets.insert(myFilteredOffsets.begin() + beginIdx, matchingOffsets.begin(), matchingOffsets.end());
+    this->myFilteredData.insert(this->myFilteredData.begin() + beginIdx, matchingDataItems.begin(),
+        matchingDataItems.end());
+}
+
+}
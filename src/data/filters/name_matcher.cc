@@ -0,0 +1,83 @@
+// name_matcher.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <utility>
+
+#include <QtConcurrent/QtConcurrent>
+
+#include "infrastructure/case_insensitive_search.h"
+
+
+
+namespace data {
+
+// number of data items matched by a single task
+static const int NAME_MATCHER_CHUNK_SIZE = 8192;
+
+// number of matched data items after which cancellation of the matching is checked
+static const int NAME_MATCHER_CANCELLATION_CHECK_INTERVAL = 1024;
+
+
+
+template <typename T>
+std::vector<std::pair<int, T*>> NameMatcher<T>::match(const std::string& foldedPattern,
+    const std::vector<NameCandidate<T>>& candidates, const std::function<bool()>& isCancelled) {
+
+    infrastructure::CaseInsensitiveSearch search{foldedPattern};
+    std::vector<std::pair<int, T*>> matchingDataItems;
+    if (candidates.size() <= static_cast<unsigned int>(NAME_MATCHER_CHUNK_SIZE)) {
+        matchChunk(search, candidates.data(), candidates.data() + candidates.size(), isCancelled, matchingDataItems);
+        return matchingDataItems;
+    }
+
+    // each chunk has its own result so that they can be merged in the original order
+    std::vector<std::pair<int, std::vector<std::pair<int, T*>>>> chunks;
+    for (unsigned int chunkBegin = 0; chunkBegin < candidates.size(); chunkBegin += NAME_MATCHER_CHUNK_SIZE) {
+        chunks.emplace_back(chunkBegin, std::vector<std::pair<int, T*>>{});
+    }
+    QtConcurrent::blockingMap(chunks, [&](std::pair<int, std::vector<std::pair<int, T*>>>& chunk) {
+        auto begin = candidates.data() + chunk.first;
+        auto end = std::min(begin + NAME_MATCHER_CHUNK_SIZE, candidates.data() + candidates.size());
+        matchChunk(search, begin, end, isCancelled, chunk.second);
+    });
+
+    size_t numberOfMatchingDataItems = 0;
+    for (auto& chunk: chunks) {
+        numberOfMatchingDataItems += chunk.second.size();
+    }
+    matchingDataItems.reserve(numberOfMatchingDataItems);
+    for (auto& chunk: chunks) {
+        matchingDataItems.insert(matchingDataItems.end(), chunk.second.begin(), chunk.second.end());
+    }
+    return matchingDataItems;
+}
+
+
+
+template <typename T>
+void NameMatcher<T>::matchChunk(const infrastructure::CaseInsensitiveSearch& search, const NameCandidate<T>* begin,
+    const NameCandidate<T>* end, const std::function<bool()>& isCancelled,
+    std::vector<std::pair<int, T*>>& matchingDataItems) {
+
+    for (auto candidateIter = begin; candidateIter != end; ++candidateIter) {
+        if (isCancelled && (candidateIter - begin) % NAME_MATCHER_CANCELLATION_CHECK_INTERVAL == 0 && isCancelled()) {
+            break;
+        }
+        if (search.isFoundIn(candidateIter->foldedName)) {
+            matchingDataItems.emplace_back(candidateIter->offset, candidateIter->dataItem);
+        }
+    }
+}
+
+}
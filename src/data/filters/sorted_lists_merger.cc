@@ -0,0 +1,60 @@
+// sorted_lists_merger.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <functional>
+#include <utility>
+
+
+
+namespace data {
+
+template <typename T>
+void SortedListsMerger<T>::merge(const std::vector<const std::vector<T*>*>& lists,
+    const std::function<bool(const T*, const T*)>& isBefore, std::vector<T*>& merged) {
+
+    merged.clear();
+    if (lists.size() == 1) {
+        merged = *lists.front();
+        return;
+    }
+
+    // unmerged parts of the lists; the heap has the part with the first data item at the front
+    using ListPart = std::pair<typename std::vector<T*>::const_iterator, typename std::vector<T*>::const_iterator>;
+    std::vector<ListPart> heap;
+    size_t numberOfDataItems = 0;
+    for (auto list: lists) {
+        if (!list->empty()) {
+            heap.emplace_back(list->begin(), list->end());
+            numberOfDataItems += list->size();
+        }
+    }
+    merged.reserve(numberOfDataItems);
+    auto isAfter = [&isBefore](const ListPart& lhs, const ListPart& rhs) {return isBefore(*rhs.first, *lhs.first); };
+    std::make_heap(heap.begin(), heap.end(), isAfter);
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), isAfter);
+        auto& listPart = heap.back();
+
+        // identical data items are equivalent so they follow each other
+        if (merged.empty() || merged.back() != *listPart.first) {
+            merged.push_back(*listPart.first);
+        }
+        if (++listPart.first == listPart.second) {
+            heap.pop_back();
+        } else {
+            std::push_heap(heap.begin(), heap.end(), isAfter);
+        }
+    }
+}
+
+}
@@ -0,0 +1,73 @@
+// id_interner.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+
+#include "data/id_interner.h"
+
+
+
+namespace data {
+
+IdInterner::IdInterner(const std::vector<std::string>& reservedIds):
+myReservedIds{reservedIds} {
+    for (auto& id: myReservedIds) {
+        add(id);
+    }
+}
+
+
+
+int IdInterner::intern(const std::string& id) {
+
+    // identifiers are usually interned already so the shared lock is tried first
+    {
+        std::shared_lock<std::shared_mutex> lock{myMutex};
+        auto handleIter = myHandles.find(id);
+        if (handleIter != myHandles.end()) {
+            return handleIter->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock{myMutex};
+    return add(id);
+}
+
+
+
+const std::string& IdInterner::getId(int handle) const {
+    std::shared_lock<std::shared_mutex> lock{myMutex};
+    return *myIds[handle];
+}
+
+
+
+void IdInterner::clear() {
+    std::unique_lock<std::shared_mutex> lock{myMutex};
+    myHandles.clear();
+    myIds.clear();
+    for (auto& id: myReservedIds) {
+        add(id);
+    }
+}
+
+
+
+int IdInterner::add(const std::string& id) {
+    auto handleAndIsInserted = myHandles.emplace(id, static_cast<int>(myIds.size()));
+    if (handleAndIsInserted.second) {
+        myIds.push_back(&handleAndIsInserted.first->first);
+    }
+    return handleAndIsInserted.first->second;
+}
+
+}
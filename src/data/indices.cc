@@ -7,12 +7,15 @@
 
 
 
+#include <cstddef>
+#include <algorithm>
 #include <functional>
 #include <utility>
 #include <vector>
 
 #include "domain/artist.h"
 #include "domain/album.h"
+#include "data/id_interner.h"
 #include "data/indices.h"
 
 using namespace domain;
@@ -21,10 +24,114 @@ using namespace domain;
 
 namespace data {
 
+// returns sorted unique keys of the given index entries
+template <typename T>
+static std::vector<int> getKeys(const std::vector<std::pair<int, T*>>& entries) {
+    std::vector<int> keys;
+    keys.reserve(entries.size());
+    for (auto& entry: entries) {
+        if (keys.empty() || keys.back() != entry.first) {
+            keys.push_back(entry.first);
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+}
+
+
+
+// returns the list of the given key; the lists are extended if necessary
+template <typename T>
+static std::vector<T*>& getList(std::vector<std::vector<T*>>& lists, int key) {
+    if (key >= static_cast<int>(lists.size())) {
+        lists.resize(key + 1);
+    }
+    return lists[key];
+}
+
+
+
+// inserts the given index entries to the sorted lists; returns sorted unique keys of the entries
+template <typename T>
+static std::vector<int> insertEntries(std::vector<std::vector<T*>>& lists,
+    const std::vector<std::pair<int, T*>>& entries, bool (*isBefore)(const T*, const T*)) {
+
+    auto keys = getKeys(entries);
+    std::vector<size_t> sortedSizes;
+    sortedSizes.reserve(keys.size());
+    for (auto key: keys) {
+        sortedSizes.push_back(getList(lists, key).size());
+    }
+    for (auto& entry: entries) {
+        lists[entry.first].push_back(entry.second);
+    }
+
+    // inserted data items are sorted and merged with the already sorted ones; the same data item can be inserted
+    // repeatedly (e. g. an album for each of its tracks) and it is kept once
+    for (size_t idx = 0; idx < keys.size(); idx++) {
+        auto& list = lists[keys[idx]];
+        auto sortedEnd = list.begin() + sortedSizes[idx];
+        std::sort(sortedEnd, list.end(), isBefore);
+        std::inplace_merge(list.begin(), sortedEnd, list.end(), isBefore);
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+    }
+    return keys;
+}
+
+
+
+// returns the list of the given key or an empty list if there is no such key
+template <typename T>
+static const std::vector<T*>& findList(const std::vector<std::vector<T*>>& lists, int key) {
+    static const std::vector<T*> emptyList;
+    return key < static_cast<int>(lists.size()) ? lists[key] : emptyList;
+}
+
+
+
+Indices::Indices(IdInterner& artistIds, IdInterner& albumIds):
+myArtistIds(artistIds),
+myAlbumIds(albumIds) {
+}
+
+
+
+int Indices::getArtistIdHandle(const Artist& artist) const {
+    return myArtistIds.intern(artist.getId());
+}
+
+
+
+int Indices::getAlbumIdHandle(const Album& album) const {
+    return myAlbumIds.intern(album.getId());
+}
+
+
+
+bool Indices::isArtistAlbumBefore(const AlbumData* lhs, const AlbumData* rhs) {
+    return *lhs < *rhs;
+}
+
+
+
+bool Indices::isArtistTrackBefore(const TrackData* lhs, const TrackData* rhs) {
+    return TrackData::NameCompare{}(*lhs, *rhs);
+}
+
+
+
+bool Indices::isAlbumTrackBefore(const TrackData* lhs, const TrackData* rhs) {
+    return *lhs < *rhs;
+}
+
+
+
 void Indices::addArtists(const std::vector<std::reference_wrapper<Artist>>& artists) {
     for (auto& artist: artists) {
-        myArtistAlbums[artist.get()] = AlbumDataUnorderedSet{};
-        myArtistTracks[artist.get()] = TrackDataUnorderedSet{};
+        auto artistIdHandle = getArtistIdHandle(artist);
+        getList(myArtistAlbums, artistIdHandle).clear();
+        getList(myArtistTracks, artistIdHandle).clear();
     }
 }
 
@@ -32,58 +139,46 @@ void Indices::addArtists(const std::vector<std::reference_wrapper<Artist>>& arti
 
 void Indices::addAlbums(const std::vector<std::reference_wrapper<Album>>& albums) {
     for (auto& album: albums) {
-        myAlbumTracks[album.get()] = TrackDataUnorderedSet{};
+        getList(myAlbumTracks, getAlbumIdHandle(album)).clear();
     }
 }
 
 
 
-AlbumDataUnorderedSet& Indices::getArtistAlbums(const Artist& artist) {
-    return myArtistAlbums.at(artist);
+const std::vector<AlbumData*>& Indices::getArtistAlbums(int artistIdHandle) const {
+    return findList(myArtistAlbums, artistIdHandle);
 }
 
 
 
 void Indices::updateArtistAlbums(const ArtistAlbumsIndex& artistAlbums) {
-    std::vector<std::reference_wrapper<const Artist>> updatedArtists;
-    for (auto& artistAndAlbums: artistAlbums) {
-        myArtistAlbums[artistAndAlbums.first].insert(artistAndAlbums.second.begin(), artistAndAlbums.second.end());
-        updatedArtists.push_back(artistAndAlbums.first);
-    }
+    auto updatedArtists = insertEntries(myArtistAlbums, artistAlbums, &Indices::isArtistAlbumBefore);
     artistAlbumsUpdated(updatedArtists);
 }
 
 
 
-TrackDataUnorderedSet& Indices::getArtistTracks(const Artist& artist) {
-    return myArtistTracks.at(artist);
+const std::vector<TrackData*>& Indices::getArtistTracks(int artistIdHandle) const {
+    return findList(myArtistTracks, artistIdHandle);
 }
 
 
 
 void Indices::updateArtistTracks(const ArtistTracksIndex& artistTracks) {
-    std::vector<std::reference_wrapper<const Artist>> updatedArtists;
-    for (auto& artistAndTracks: artistTracks) {
-        myArtistTracks[artistAndTracks.first].insert(artistAndTracks.second.begin(), artistAndTracks.second.end());
-        updatedArtists.push_back(artistAndTracks.first);
-    }
+    auto updatedArtists = insertEntries(myArtistTracks, artistTracks, &Indices::isArtistTrackBefore);
     artistTracksUpdated(updatedArtists);
 }
 
 
 
-TrackDataUnorderedSet& Indices::getAlbumTracks(const Album& album) {
-    return myAlbumTracks.at(album);
+const std::vector<TrackData*>& Indices::getAlbumTracks(int albumIdHandle) const {
+    return findList(myAlbumTracks, albumIdHandle);
 }
 
 
 
 void Indices::updateAlbumTracks(const AlbumTracksIndex& albumTracks) {
-    std::vector<std::reference_wrapper<const Album>> updatedAlbums;
-    for (auto& albumAndTracks: albumTracks) {
-        myAlbumTracks[albumAndTracks.first].insert(albumAndTracks.second.begin(), albumAndTracks.second.end());
-        updatedAlbums.push_back(albumAndTracks.first);
-    }
+    auto updatedAlbums = insertEntries(myAlbumTracks, albumTracks, &Indices::isAlbumTrackBefore);
     albumTracksUpdated(updatedAlbums);
 }
 
@@ -103,30 +198,30 @@ void Indices::clearAlbums() {
 
 
 void Indices::clearArtistsAlbums() {
-    for (auto& artistAndAlbums: myArtistAlbums) {
-        artistAndAlbums.second.clear();
+    for (auto& albumsData: myArtistAlbums) {
+        albumsData.clear();
     }
-    std::vector<std::reference_wrapper<const Artist>> updatedArtists;
+    std::vector<int> updatedArtists;
     artistAlbumsUpdated(updatedArtists);
 }
 
 
 
 void Indices::clearArtistsTracks() {
-    for (auto& artistAndTracls: myArtistTracks) {
-        artistAndTracls.second.clear();
+    for (auto& tracksData: myArtistTracks) {
+        tracksData.clear();
     }
-    std::vector<std::reference_wrapper<const Artist>> updatedArtists;
+    std::vector<int> updatedArtists;
     artistTracksUpdated(updatedArtists);
 }
 
 
 
 void Indices::clearAlbumsTracks() {
-    for (auto& albumAndTracks: myAlbumTracks) {
-        albumAndTracks.second.clear();
+    for (auto& tracksData: myAlbumTracks) {
+        tracksData.clear();
     }
-    std::vector<std::reference_wrapper<const Album>> updatedAlbums;
+    std::vector<int> updatedAlbums;
     albumTracksUpdated(updatedAlbums);
 }
 
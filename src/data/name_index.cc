@@ -0,0 +1,174 @@
+// name_index.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+
+#include <QChar>
+#include <QString>
+
+#include "data/name_index.h"
+
+
+
+namespace data {
+
+// size of blocks of memory which store the folded names
+static const size_t NAME_BLOCK_SIZE = 1024 * 1024;
+
+
+
+NameIndex::NameIndex(bool isIgnoringDiacritics):
+myIsIgnoringDiacritics(isIgnoringDiacritics) {
+}
+
+
+
+void NameIndex::add(int position, const std::string& name) {
+    auto foldedName = fold(name);
+    if (position >= static_cast<int>(myFoldedNames.size())) {
+        myFoldedNames.resize(position + 1);
+    }
+    myFoldedNames[position] = storeFoldedName(foldedName);
+
+    for (auto trigram: createTrigrams(foldedName)) {
+        auto& postingList = myPostingLists[trigram];
+
+        // names are added mostly in the order of their positions so the position is usually appended
+        if (postingList.empty() || postingList.back() < position) {
+            postingList.push_back(position);
+        } else {
+            postingList.insert(std::upper_bound(postingList.begin(), postingList.end(), position), position);
+        }
+    }
+}
+
+
+
+void NameIndex::clear() {
+    myPostingLists.clear();
+    myFoldedNames.clear();
+    myNameBlocks.clear();
+    myNameBlockFree = nullptr;
+    myNameBlockFreeSize = 0;
+}
+
+
+
+std::string_view NameIndex::getFoldedName(int position) const {
+    return position < static_cast<int>(myFoldedNames.size()) ? myFoldedNames[position] : std::string_view{};
+}
+
+
+
+std::string NameIndex::fold(const std::string& str) const {
+    if (std::all_of(str.begin(), str.end(), [](char c) {return static_cast<unsigned char>(c) < 0x80; })) {
+        std::string folded{str};
+        for (auto& c: folded) {
+            if (c >= 'A' && c <= 'Z') {
+                c = c - 'A' + 'a';
+            }
+        }
+        return folded;
+    }
+
+    auto folded = QString::fromStdString(str).toCaseFolded();
+    if (myIsIgnoringDiacritics) {
+        // diacritical marks are separated from the letters by the decomposition
+        auto decomposed = folded.normalized(QString::NormalizationForm_D);
+        folded = QString{};
+        folded.reserve(decomposed.size());
+        for (auto ch: decomposed) {
+            if (ch.category() != QChar::Mark_NonSpacing) {
+                folded.append(ch);
+            }
+        }
+    }
+    return folded.normalized(QString::NormalizationForm_C).toStdString();
+}
+
+
+
+bool NameIndex::findCandidates(const std::string& pattern, std::vector<int>& candidates) const {
+    candidates.clear();
+    auto trigrams = createTrigrams(pattern);
+    if (trigrams.empty()) {
+        return false;
+    }
+
+    std::vector<const std::vector<int>*> postingLists;
+    for (auto trigram: trigrams) {
+        auto postingListIter = myPostingLists.find(trigram);
+        if (postingListIter == myPostingLists.end()) {
+            return true;
+        }
+        postingLists.push_back(&postingListIter->second);
+    }
+
+    // intersect from the shortest list so that the intermediate results are as small as possible
+    std::sort(postingLists.begin(), postingLists.end(),
+        [](const std::vector<int>* lhs, const std::vector<int>* rhs) {return lhs->size() < rhs->size(); });
+    candidates = *postingLists.front();
+    std::vector<int> intersection;
+    for (auto postingListIter = postingLists.begin() + 1; postingListIter != postingLists.end() && !candidates.empty();
+        ++postingListIter) {
+
+        intersection.clear();
+        std::set_intersection(candidates.begin(), candidates.end(), (*postingListIter)->begin(),
+            (*postingListIter)->end(), std::back_inserter(intersection));
+        candidates.swap(intersection);
+    }
+    return true;
+}
+
+
+
+std::vector<uint32_t> NameIndex::createTrigrams(const std::string& str) {
+    std::vector<uint32_t> trigrams;
+    if (str.size() < 3) {
+        return trigrams;
+    }
+
+    trigrams.reserve(str.size() - 2);
+    for (size_t idx = 0; idx + 2 < str.size(); idx++) {
+        uint32_t trigram = static_cast<unsigned char>(str[idx]);
+        trigram = (trigram << 8) | static_cast<unsigned char>(str[idx + 1]);
+        trigram = (trigram << 8) | static_cast<unsigned char>(str[idx + 2]);
+        trigrams.push_back(trigram);
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+
+
+std::string_view NameIndex::storeFoldedName(const std::string& foldedName) {
+    if (foldedName.size() > myNameBlockFreeSize) {
+        auto blockSize = std::max(NAME_BLOCK_SIZE, foldedName.size());
+        myNameBlocks.emplace_back(new char[blockSize]);
+        myNameBlockFree = myNameBlocks.back().get();
+        myNameBlockFreeSize = blockSize;
+    }
+
+    std::string_view storedName{myNameBlockFree, foldedName.size()};
+    memcpy(myNameBlockFree, foldedName.data(), foldedName.size());
+    myNameBlockFree += foldedName.size();
+    myNameBlockFreeSize -= foldedName.size();
+    return storedName;
+}
+
+}
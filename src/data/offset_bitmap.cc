@@ -0,0 +1,114 @@
+// offset_bitmap.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <cstdint>
+#include <vector>
+
+#include "data/offset_bitmap.h"
+
+
+
+namespace data {
+
+// number of bits in a word of the bitmaps
+static const int WORD_BITS = 64;
+
+// word with all bits set
+static const uint64_t FULL_WORD = ~uint64_t{0};
+
+
+
+// creates mask of the bits from the range of bits <first, last> which are in the given word
+static uint64_t createMask(int wordIdx, int first, int last) {
+    auto mask = FULL_WORD;
+    if (wordIdx == first / WORD_BITS) {
+        mask &= FULL_WORD << (first % WORD_BITS);
+    }
+    if (wordIdx == last / WORD_BITS) {
+        mask &= FULL_WORD >> (WORD_BITS - 1 - last % WORD_BITS);
+    }
+    return mask;
+}
+
+
+
+void OffsetBitmap::set(int offset, int count) {
+    if (offset < 0 || count <= 0) {
+        return;
+    }
+
+    auto last = offset + count - 1;
+    auto numberOfWords = last / WORD_BITS + 1;
+    if (static_cast<int>(myWords.size()) < numberOfWords) {
+        myWords.resize(numberOfWords);
+        myFullWords.resize((numberOfWords + WORD_BITS - 1) / WORD_BITS);
+    }
+    setBits(myWords, offset, last);
+
+    for (auto wordIdx = offset / WORD_BITS; wordIdx <= last / WORD_BITS; wordIdx++) {
+        if (myWords[wordIdx] == FULL_WORD) {
+            setBits(myFullWords, wordIdx, wordIdx);
+        }
+    }
+}
+
+
+
+void OffsetBitmap::clear() {
+    myWords.clear();
+    myFullWords.clear();
+}
+
+
+
+bool OffsetBitmap::contains(int offset, int count) const {
+    if (offset < 0 || count < 0) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+
+    auto last = offset + count - 1;
+    auto firstWord = offset / WORD_BITS;
+    auto lastWord = last / WORD_BITS;
+    if (lastWord >= static_cast<int>(myWords.size())) {
+        return false;
+    }
+    if (lastWord - firstWord < 2) {
+        return areBitsSet(myWords, offset, last);
+    }
+
+    // words between the first and the last one are checked by the summary
+    return areBitsSet(myWords, offset, firstWord * WORD_BITS + WORD_BITS - 1) &&
+        areBitsSet(myWords, lastWord * WORD_BITS, last) && areBitsSet(myFullWords, firstWord + 1, lastWord - 1);
+}
+
+
+
+void OffsetBitmap::setBits(std::vector<uint64_t>& words, int first, int last) {
+    for (auto wordIdx = first / WORD_BITS; wordIdx <= last / WORD_BITS; wordIdx++) {
+        auto mask = createMask(wordIdx, first, last);
+        words[wordIdx] |= mask;
+    }
+}
+
+
+
+bool OffsetBitmap::areBitsSet(const std::vector<uint64_t>& words, int first, int last) {
+    for (auto wordIdx = first / WORD_BITS; wordIdx <= last / WORD_BITS; wordIdx++) {
+        auto mask = createMask(wordIdx, first, last);
+        if ((words[wordIdx] & mask) != mask) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
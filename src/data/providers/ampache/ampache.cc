@@ -23,6 +23,8 @@
 #include <QString>
 #include <QDateTime>
 #include <QThreadPool>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrent>
 #include <QColor>
 #include <QPixmap>
 #include <QXmlStreamReader>
@@ -36,6 +38,7 @@
 #include "../../data_objects/artist_data.h"
 #include "../../data_objects/track_data.h"
 #include "data/providers/ampache/scale_album_art_runnable.h"
+#include "data/id_interner.h"
 #include "data/providers/connection_info.h"
 #include "ampache_url.h"
 #include "data/providers/ampache/ampache.h"
@@ -48,17 +51,25 @@ using namespace domain;
 
 namespace data {
 
-Ampache::Ampache(
-    const ConnectionInfo& connectionInfo, const Ampache::NetworkRequestFn& networkRequestFn, int albumThumbnailSize):
+Ampache::Ampache(const ConnectionInfo& connectionInfo, const Ampache::NetworkRequestFn& networkRequestFn,
+    int albumThumbnailSize, IdInterner& artistIds, IdInterner& albumIds):
 myConnectionInfo{connectionInfo},
 myNetworkRequestFn{networkRequestFn},
 myAlbumThumbnailSize{albumThumbnailSize},
+myArtistIds{artistIds},
+myAlbumIds{albumIds},
 myNetworkRequestCb{bind(&Ampache::onNetworkRequestFinished, this, _1, _2, _3)},
 myAlbumArtsNetworkRequestCb{bind(&Ampache::onAlbumArtsNetworkRequestFinished, this, _1, _2, _3)} {
 }
 
 
 
+Ampache::~Ampache() {
+    myParsingThreadPool.waitForDone();
+}
+
+
+
 bool Ampache::getIsInitialized() const {
     return myIsInitialized;
 }
@@ -83,6 +94,12 @@ std::chrono::system_clock::time_point Ampache::getLastUpdate() const {
 
 
 
+std::chrono::system_clock::time_point Ampache::getLastClean() const {
+    return myLastClean;
+}
+
+
+
 int Ampache::numberOfAlbums() const {
     return myNumberOfAlbums;
 }
@@ -113,18 +130,39 @@ void Ampache::requestAlbums(int offset, int limit) {
 
 
 
+void Ampache::requestAlbums(int offset, int limit, Change change, std::chrono::system_clock::time_point since) {
+    callMethod(Method.Albums, {{"offset", std::to_string(offset)}, {"limit", std::to_string(limit)},
+        createChangeArgument(change, since)});
+}
+
+
+
 void Ampache::requestArtists(int offset, int limit) {
     callMethod(Method.Artists, {{"offset",  std::to_string(offset)}, {"limit", std::to_string(limit)}});
 }
 
 
 
+void Ampache::requestArtists(int offset, int limit, Change change, std::chrono::system_clock::time_point since) {
+    callMethod(Method.Artists, {{"offset", std::to_string(offset)}, {"limit", std::to_string(limit)},
+        createChangeArgument(change, since)});
+}
+
+
+
 void Ampache::requestTracks(int offset, int limit) {
     callMethod(Method.Tracks, {{"offset", std::to_string(offset)}, {"limit", std::to_string(limit)}});
 }
 
 
 
+void Ampache::requestTracks(int offset, int limit, Change change, std::chrono::system_clock::time_point since) {
+    callMethod(Method.Tracks, {{"offset", std::to_string(offset)}, {"limit", std::to_string(limit)},
+        createChangeArgument(change, since)});
+}
+
+
+
 void Ampache::requestAlbumArts(const std::map<std::string, std::string>& idsAndUrls) {
     if (idsAndUrls.empty() || !getIsInitialized()) {
         auto emptyAlbumArts = std::map<std::string, QPixmap>{};
@@ -172,14 +210,31 @@ std::string Ampache::refreshUrl(const std::string& url) const {
 
 void Ampache::onNetworkRequestFinished(const std::string& url, const char* content, int contentSize) {
     auto qByteArrayContent = QByteArray{content, contentSize};
+    AmpacheUrl ampacheUrl{url};
+    std::string methodName = ampacheUrl.parseActionValue();
+    auto offsetValue = ampacheUrl.parseOffsetValue();
+    int offset = offsetValue.empty() ? 0 : stoi(offsetValue);
+    LOG_DBG("Server call of method '%s' from offset %d has returned with content of length %d.", methodName.c_str(),
+        offset, contentSize);
+
+    // responses with data can be large; they are parsed in a single pass (including error detection) on a worker
+    // thread in order not to block the caller
+    if (methodName == Method.Albums) {
+        startParsing(offset, qByteArrayContent, &Ampache::createAlbums, SLOT(onAlbumsParsingFinished()));
+        return;
+    } else if (methodName == Method.Artists) {
+        startParsing(offset, qByteArrayContent, &Ampache::createArtists, SLOT(onArtistsParsingFinished()));
+        return;
+    } else if (methodName == Method.Tracks) {
+        startParsing(offset, qByteArrayContent, &Ampache::createTracks, SLOT(onTracksParsingFinished()));
+        return;
+    }
+
     QXmlStreamReader errorXmlStreamReader{qByteArrayContent};
     bool error = isError(errorXmlStreamReader);
 
     QXmlStreamReader xmlStreamReader{qByteArrayContent};
-    std::string methodName = AmpacheUrl{url}.parseActionValue();
-    LOG_DBG("Server call of method '%s' has returned with content of length %d and error %d.",  methodName.c_str(),
-        contentSize, error);
-    dispatchToMethodHandler(methodName, xmlStreamReader, error);
+    dispatchToMethodHandler(methodName, offset, xmlStreamReader, error);
 }
 
 
@@ -226,6 +281,24 @@ void Ampache::onScaleAlbumArtRunnableFinished(ScaleAlbumArtRunnable* scaleAlbumA
 
 
 
+void Ampache::onAlbumsParsingFinished() {
+    finishParsing(readyAlbums);
+}
+
+
+
+void Ampache::onArtistsParsingFinished() {
+    finishParsing(readyArtists);
+}
+
+
+
+void Ampache::onTracksParsingFinished() {
+    finishParsing(readyTracks);
+}
+
+
+
 void Ampache::connectToServer() {
     LOG_DBG("Handshaking with server.");
     auto currentTime = std::to_string(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().
@@ -246,7 +319,9 @@ void Ampache::connectToServer() {
 void Ampache::callMethod(const std::string& name, const std::map<std::string, std::string>& arguments) {
     if (!getIsInitialized()) {
         QXmlStreamReader xmlStreamReader;
-        dispatchToMethodHandler(name, xmlStreamReader, true);
+        auto offsetIter = arguments.find("offset");
+        int offset = offsetIter != arguments.end() ? stoi(offsetIter->second) : 0;
+        dispatchToMethodHandler(name, offset, xmlStreamReader, true);
         return;
     }
 
@@ -283,7 +358,9 @@ bool Ampache::isError(QXmlStreamReader& xmlStreamReader) {
 
 
 
-void Ampache::dispatchToMethodHandler(const std::string& methodName, QXmlStreamReader& xmlStreamReader, bool error) {
+void Ampache::dispatchToMethodHandler(const std::string& methodName, int offset, QXmlStreamReader& xmlStreamReader,
+    bool error) {
+
     if (error) {
         myIsInitialized = false;
     }
@@ -293,11 +370,11 @@ void Ampache::dispatchToMethodHandler(const std::string& methodName, QXmlStreamR
     } else if (methodName == Method.Ping || (methodName == Method.Handshake && myIsRefreshingSession)) {
         processPing(xmlStreamReader,  error, methodName == Method.Handshake);
     } else if (methodName == Method.Albums) {
-        processAlbums(xmlStreamReader, error);
+        processAlbums(offset, xmlStreamReader, error);
     } else if (methodName == Method.Artists) {
-        processArtists(xmlStreamReader, error);
+        processArtists(offset, xmlStreamReader, error);
     } else if (methodName == Method.Tracks) {
-        processTracks(xmlStreamReader, error);
+        processTracks(offset, xmlStreamReader, error);
     }
 }
 
@@ -335,6 +412,7 @@ void Ampache::processPing(QXmlStreamReader& xmlStreamReader, bool error, bool is
 void Ampache::readHandshakeData(QXmlStreamReader& xmlStreamReader) {
     QDateTime update{};
     QDateTime add{};
+    QDateTime clean{};
     while (!xmlStreamReader.atEnd()) {
         xmlStreamReader.readNext();
         auto xmlElement = xmlStreamReader.name().toString();
@@ -349,6 +427,8 @@ void Ampache::readHandshakeData(QXmlStreamReader& xmlStreamReader) {
             update = QDateTime::fromString(QString::fromStdString(value), Qt::ISODate);
         } else if (xmlElement == "add") {
             add = QDateTime::fromString(QString::fromStdString(value), Qt::ISODate);
+        } else if (xmlElement == "clean") {
+            clean = QDateTime::fromString(QString::fromStdString(value), Qt::ISODate);
         } else if (xmlElement == "albums") {
             myNumberOfAlbums = stoi(value);
         } else if (xmlElement ==  "artists") {
@@ -359,6 +439,9 @@ void Ampache::readHandshakeData(QXmlStreamReader& xmlStreamReader) {
     }
     myLastUpdate = std::chrono::system_clock::time_point{
         std::chrono::milliseconds{std::max(update, add).toMSecsSinceEpoch()}};
+    myLastClean = clean.isValid() ?
+        std::chrono::system_clock::time_point{std::chrono::milliseconds{clean.toMSecsSinceEpoch()}} :
+        std::chrono::system_clock::time_point::min();
 
     if (xmlStreamReader.hasError()) {
       // TODO: handle error
@@ -367,26 +450,25 @@ void Ampache::readHandshakeData(QXmlStreamReader& xmlStreamReader) {
 
 
 
-void Ampache::processAlbums(QXmlStreamReader& xmlStreamReader, bool error) {
+void Ampache::processAlbums(int offset, QXmlStreamReader& xmlStreamReader, bool error) {
     std::vector<std::unique_ptr<AlbumData>> albumsData{};
     if (!error) {
-        albumsData = createAlbums(xmlStreamReader);
+        albumsData = createAlbums(xmlStreamReader, error);
     }
 
-    auto dataAndError = make_pair(std::move(albumsData), error);
-    readyAlbums(dataAndError);
+    auto readyData = ReadyData<AlbumData>{offset, std::move(albumsData), error};
+    readyAlbums(readyData);
 }
 
 
 
-std::vector<std::unique_ptr<AlbumData>> Ampache::createAlbums(QXmlStreamReader& xmlStreamReader) const {
+std::vector<std::unique_ptr<AlbumData>> Ampache::createAlbums(QXmlStreamReader& xmlStreamReader, bool& error) const {
     std::vector<std::unique_ptr<AlbumData>> albumData{};
 
-    QString xmlElement;
-    while ((!xmlStreamReader.atEnd()) && (xmlElement != "root")) {
+    while (!xmlStreamReader.atEnd()) {
         xmlStreamReader.readNext();
-        if (xmlStreamReader.isStartElement()) {
-            xmlElement = xmlStreamReader.name().toString();
+        if (xmlStreamReader.isStartElement() && toElement(xmlStreamReader.name()) == Element::Root) {
+            break;
         }
     }
 
@@ -399,12 +481,12 @@ std::vector<std::unique_ptr<AlbumData>> Ampache::createAlbums(QXmlStreamReader&
     std::string artistId = "";
     while (!xmlStreamReader.atEnd()) {
         xmlStreamReader.readNext();
-        xmlElement = xmlStreamReader.name().toString();
+        auto xmlElement = toElement(xmlStreamReader.name());
 
         if (xmlStreamReader.isEndElement()) {
-            if (xmlElement == "album") {albumData.emplace_back(
-                new AlbumData{
-                    id, artUrl, artistId, tracks, std::unique_ptr<Album>{new Album{id, albumName, year, disk}}});
+            if (xmlElement == Element::Album) {albumData.emplace_back(
+                new AlbumData{id, artUrl, myArtistIds.intern(artistId), tracks,
+                    std::unique_ptr<Album>{new Album{id, albumName, year, disk}}});
             }
         }
 
@@ -412,49 +494,49 @@ std::vector<std::unique_ptr<AlbumData>> Ampache::createAlbums(QXmlStreamReader&
             continue;
         }
 
-        if (xmlElement == "album") {
-            QXmlStreamAttributes attributes = xmlStreamReader.attributes();
-            if (attributes.hasAttribute("id")) {
-                id = attributes.value("id").toString().trimmed().toStdString();
-            }
-        } else if (xmlElement == "artist") {
-            QXmlStreamAttributes attributes = xmlStreamReader.attributes();
-            if (attributes.hasAttribute("id")) {
-                artistId = attributes.value("id").toString().trimmed().toStdString();
-            }
-        }
-        else {
-            auto value = xmlStreamReader.readElementText().trimmed().toStdString();
-
-            if (xmlElement == "name") {
-                albumName = value;
-            } else if (xmlElement == "year") {
-                year = 0;
-                try {
-                    year = stoi(value);
-                } catch (const std::invalid_argument& ex) {}
-                catch (const std::out_of_range& ex) {}
-            } else if (xmlElement == "disk") {
-                disk = 0;
-                try {
-                    disk = stoi(value);
-                } catch (const std::invalid_argument& ex) {}
-                catch (const std::out_of_range& ex) {}
-            } else if (xmlElement == "tracks") {
-                tracks = 0;
-                try {
-                    tracks = stoi(value);
-                } catch (const std::invalid_argument& ex) {}
-                catch (const std::out_of_range& ex) {}
-            } else if (xmlElement == "art") {
+        switch (xmlElement) {
+            case Element::Error:
+                error = true;
+                break;
+            case Element::Album:
+                id = readIdAttribute(xmlStreamReader);
+                break;
+            case Element::Artist:
+                artistId = readIdAttribute(xmlStreamReader);
+                break;
+            case Element::Name:
+                albumName = toStdString(xmlStreamReader.readElementText().trimmed());
+                break;
+
+            // numbers are 0 if not valid
+            case Element::Year:
+                year = xmlStreamReader.readElementText().trimmed().toInt();
+                break;
+            case Element::Disk:
+                disk = xmlStreamReader.readElementText().trimmed().toInt();
+                break;
+            case Element::Tracks:
+                tracks = xmlStreamReader.readElementText().trimmed().toInt();
+                break;
+            case Element::Art:
                 // TODO: Sanitize URL.
-                artUrl = value;
-            }
+                artUrl = toStdString(xmlStreamReader.readElementText().trimmed());
+                break;
+            default:
+                xmlStreamReader.skipCurrentElement();
+        }
+        if (error) {
+            break;
         }
     }
 
-    if (xmlStreamReader.hasError()) {
-      // TODO: handle error
+    // only an error response fails the request; entries of a malformed response parsed before the malformation are
+    // kept and the rest is treated as unavailable
+    if (error) {
+        albumData.clear();
+    } else if (xmlStreamReader.hasError()) {
+        LOG_WARN("Response with albums is malformed at line %d; %d entries were read.",
+            static_cast<int>(xmlStreamReader.lineNumber()), albumData.size());
     }
 
     return albumData;
@@ -462,26 +544,25 @@ std::vector<std::unique_ptr<AlbumData>> Ampache::createAlbums(QXmlStreamReader&
 
 
 
-void Ampache::processArtists(QXmlStreamReader& xmlStreamReader, bool error) {
+void Ampache::processArtists(int offset, QXmlStreamReader& xmlStreamReader, bool error) {
     std::vector<std::unique_ptr<ArtistData>> artistsData{};
     if (!error) {
-        artistsData = createArtists(xmlStreamReader);
+        artistsData = createArtists(xmlStreamReader, error);
     }
 
-    auto dataAndError = make_pair(std::move(artistsData), error);
-    readyArtists(dataAndError);
+    auto readyData = ReadyData<ArtistData>{offset, std::move(artistsData), error};
+    readyArtists(readyData);
 }
 
 
 
-std::vector<std::unique_ptr<ArtistData>> Ampache::createArtists(QXmlStreamReader& xmlStreamReader) const {
+std::vector<std::unique_ptr<ArtistData>> Ampache::createArtists(QXmlStreamReader& xmlStreamReader, bool& error) const {
     std::vector<std::unique_ptr<ArtistData>> artistsData{};
 
-    QString xmlElement;
-    while ((!xmlStreamReader.atEnd()) && (xmlElement != "root")) {
+    while (!xmlStreamReader.atEnd()) {
         xmlStreamReader.readNext();
-        if (xmlStreamReader.isStartElement()) {
-            xmlElement = xmlStreamReader.name().toString();
+        if (xmlStreamReader.isStartElement() && toElement(xmlStreamReader.name()) == Element::Root) {
+            break;
         }
     }
 
@@ -491,10 +572,10 @@ std::vector<std::unique_ptr<ArtistData>> Ampache::createArtists(QXmlStreamReader
     int songs = 0;
     while (!xmlStreamReader.atEnd()) {
         xmlStreamReader.readNext();
-        xmlElement = xmlStreamReader.name().toString();
+        auto xmlElement = toElement(xmlStreamReader.name());
 
         if (xmlStreamReader.isEndElement()) {
-            if (xmlElement == "artist") {
+            if (xmlElement == Element::Artist) {
                 artistsData.emplace_back(new ArtistData{id, albums, songs,
                     std::unique_ptr<Artist>{new Artist{id, artistName}}});
             }
@@ -504,35 +585,39 @@ std::vector<std::unique_ptr<ArtistData>> Ampache::createArtists(QXmlStreamReader
             continue;
         }
 
-        if (xmlElement == "artist") {
-            QXmlStreamAttributes attributes = xmlStreamReader.attributes();
-            if (attributes.hasAttribute("id")) {
-                id = attributes.value("id").toString().trimmed().toStdString();
-            }
+        switch (xmlElement) {
+            case Element::Error:
+                error = true;
+                break;
+            case Element::Artist:
+                id = readIdAttribute(xmlStreamReader);
+                break;
+            case Element::Name:
+                artistName = toStdString(xmlStreamReader.readElementText().trimmed());
+                break;
+
+            // numbers are 0 if not valid
+            case Element::Albums:
+                albums = xmlStreamReader.readElementText().trimmed().toInt();
+                break;
+            case Element::Songs:
+                songs = xmlStreamReader.readElementText().trimmed().toInt();
+                break;
+            default:
+                xmlStreamReader.skipCurrentElement();
         }
-        else {
-            auto value = xmlStreamReader.readElementText().trimmed().toStdString();
-
-            if (xmlElement == "name") {
-                artistName = value;
-            } else if (xmlElement == "albums") {
-                albums = 0;
-                try {
-                    albums = stoi(value);
-                } catch (const std::invalid_argument& ex) {}
-                catch (const std::out_of_range& ex) {}
-            } else if (xmlElement == "songs") {
-                songs = 0;
-                try {
-                    songs = stoi(value);
-                } catch (const std::invalid_argument& ex) {}
-                catch (const std::out_of_range& ex) {}
-            }
+        if (error) {
+            break;
         }
     }
 
-    if (xmlStreamReader.hasError()) {
-      // TODO: handle error
+    // only an error response fails the request; entries of a malformed response parsed before the malformation are
+    // kept and the rest is treated as unavailable
+    if (error) {
+        artistsData.clear();
+    } else if (xmlStreamReader.hasError()) {
+        LOG_WARN("Response with artists is malformed at line %d; %d entries were read.",
+            static_cast<int>(xmlStreamReader.lineNumber()), artistsData.size());
     }
 
     return artistsData;
@@ -540,26 +625,25 @@ std::vector<std::unique_ptr<ArtistData>> Ampache::createArtists(QXmlStreamReader
 
 
 
-void Ampache::processTracks(QXmlStreamReader& xmlStreamReader, bool error) {
+void Ampache::processTracks(int offset, QXmlStreamReader& xmlStreamReader, bool error) {
     std::vector<std::unique_ptr<TrackData>> tracksData{};
     if (!error) {
-        tracksData = createTracks(xmlStreamReader);
+        tracksData = createTracks(xmlStreamReader, error);
     }
 
-    auto dataAndError = make_pair(std::move(tracksData), error);
-    readyTracks(dataAndError);
+    auto readyData = ReadyData<TrackData>{offset, std::move(tracksData), error};
+    readyTracks(readyData);
 }
 
 
 
-std::vector<std::unique_ptr<TrackData>> Ampache::createTracks(QXmlStreamReader& xmlStreamReader) const {
+std::vector<std::unique_ptr<TrackData>> Ampache::createTracks(QXmlStreamReader& xmlStreamReader, bool& error) const {
     std::vector<std::unique_ptr<TrackData>> tracksData{};
 
-    QString xmlElement;
-    while ((!xmlStreamReader.atEnd()) && (xmlElement != "root")) {
+    while (!xmlStreamReader.atEnd()) {
         xmlStreamReader.readNext();
-        if (xmlStreamReader.isStartElement()) {
-            xmlElement = xmlStreamReader.name().toString();
+        if (xmlStreamReader.isStartElement() && toElement(xmlStreamReader.name()) == Element::Root) {
+            break;
         }
     }
 
@@ -572,12 +656,12 @@ std::vector<std::unique_ptr<TrackData>> Ampache::createTracks(QXmlStreamReader&
     std::string albumId = "";
     while (!xmlStreamReader.atEnd()) {
         xmlStreamReader.readNext();
-        xmlElement = xmlStreamReader.name().toString();
+        auto xmlElement = toElement(xmlStreamReader.name());
 
         if (xmlStreamReader.isEndElement()) {
-            if (xmlElement == "song") {
-                tracksData.emplace_back(new TrackData{
-                    id, artistId, albumId, std::unique_ptr<Track>{new Track{id, title, disk, number, url}}});
+            if (xmlElement == Element::Song) {
+                tracksData.emplace_back(new TrackData{id, myArtistIds.intern(artistId), myAlbumIds.intern(albumId),
+                    title, disk, number, url});
             }
         }
 
@@ -585,44 +669,49 @@ std::vector<std::unique_ptr<TrackData>> Ampache::createTracks(QXmlStreamReader&
             continue;
         }
 
-        if (xmlElement == "song") {
-            QXmlStreamAttributes attributes = xmlStreamReader.attributes();
-            if (attributes.hasAttribute("id")) {
-                id = attributes.value("id").toString().trimmed().toStdString();
-            }
-        } else if (xmlElement == "artist") {
-            QXmlStreamAttributes attributes = xmlStreamReader.attributes();
-            if (attributes.hasAttribute("id")) {
-                artistId = attributes.value("id").toString().trimmed().toStdString();
-            }
-        } else if (xmlElement == "album") {
-            QXmlStreamAttributes attributes = xmlStreamReader.attributes();
-            if (attributes.hasAttribute("id")) {
-                albumId = attributes.value("id").toString().trimmed().toStdString();
-            }
-        }
-        else {
-            auto value = xmlStreamReader.readElementText().trimmed().toStdString();
-
-            if (xmlElement == "title") {
-                title = value;
-            } else if (xmlElement == "disk") {
-                disk = value;
-            } else if (xmlElement == "track") {
-                number = 0;
-                try {
-                    number = stoi(value);
-                } catch (const std::invalid_argument& ex) {}
-                catch (const std::out_of_range& ex) {}
-            } else if (xmlElement == "url") {
+        switch (xmlElement) {
+            case Element::Error:
+                error = true;
+                break;
+            case Element::Song:
+                id = readIdAttribute(xmlStreamReader);
+                break;
+            case Element::Artist:
+                artistId = readIdAttribute(xmlStreamReader);
+                break;
+            case Element::Album:
+                albumId = readIdAttribute(xmlStreamReader);
+                break;
+            case Element::Title:
+                title = toStdString(xmlStreamReader.readElementText().trimmed());
+                break;
+            case Element::Disk:
+                disk = toStdString(xmlStreamReader.readElementText().trimmed());
+                break;
+
+            // number is 0 if not valid
+            case Element::Track:
+                number = xmlStreamReader.readElementText().trimmed().toInt();
+                break;
+            case Element::Url:
                 // TODO: Sanitize URL.
-                url = value;
-            }
+                url = toStdString(xmlStreamReader.readElementText().trimmed());
+                break;
+            default:
+                xmlStreamReader.skipCurrentElement();
+        }
+        if (error) {
+            break;
         }
     }
 
-    if (xmlStreamReader.hasError()) {
-      // TODO: handle error
+    // only an error response fails the request; entries of a malformed response parsed before the malformation are
+    // kept and the rest is treated as unavailable
+    if (error) {
+        tracksData.clear();
+    } else if (xmlStreamReader.hasError()) {
+        LOG_WARN("Response with tracks is malformed at line %d; %d entries were read.",
+            static_cast<int>(xmlStreamReader.lineNumber()), tracksData.size());
     }
 
     return tracksData;
@@ -630,6 +719,92 @@ std::vector<std::unique_ptr<TrackData>> Ampache::createTracks(QXmlStreamReader&
 
 
 
+// names are compared without conversion to QString; the most frequent elements are tested first
+template <typename S>
+Ampache::Element Ampache::toElement(const S& name) {
+    if (name == QLatin1String{"song"}) {
+        return Element::Song;
+    } else if (name == QLatin1String{"title"}) {
+        return Element::Title;
+    } else if (name == QLatin1String{"artist"}) {
+        return Element::Artist;
+    } else if (name == QLatin1String{"album"}) {
+        return Element::Album;
+    } else if (name == QLatin1String{"name"}) {
+        return Element::Name;
+    } else if (name == QLatin1String{"track"}) {
+        return Element::Track;
+    } else if (name == QLatin1String{"disk"}) {
+        return Element::Disk;
+    } else if (name == QLatin1String{"url"}) {
+        return Element::Url;
+    } else if (name == QLatin1String{"year"}) {
+        return Element::Year;
+    } else if (name == QLatin1String{"tracks"}) {
+        return Element::Tracks;
+    } else if (name == QLatin1String{"art"}) {
+        return Element::Art;
+    } else if (name == QLatin1String{"albums"}) {
+        return Element::Albums;
+    } else if (name == QLatin1String{"songs"}) {
+        return Element::Songs;
+    } else if (name == QLatin1String{"root"}) {
+        return Element::Root;
+    } else if (name == QLatin1String{"error"}) {
+        return Element::Error;
+    }
+    return Element::Other;
+}
+
+
+
+std::string Ampache::readIdAttribute(QXmlStreamReader& xmlStreamReader) {
+    return toStdString(xmlStreamReader.attributes().value(QLatin1String{"id"}).trimmed());
+}
+
+
+
+template <typename S>
+std::string Ampache::toStdString(const S& text) {
+    auto utf8Text = text.toUtf8();
+    return std::string{utf8Text.constData(), static_cast<std::string::size_type>(utf8Text.size())};
+}
+
+
+
+template <typename T>
+void Ampache::startParsing(int offset, const QByteArray& content,
+    std::vector<std::unique_ptr<T>> (Ampache::*createFn)(QXmlStreamReader&, bool&) const, const char* finishedSlot) {
+
+    // the parsing uses this instance; it is waited for in the destructor which also deletes the watcher
+    auto parsingFutureWatcher = new QFutureWatcher<std::shared_ptr<ReadyData<T>>>(this);
+    connect(parsingFutureWatcher, SIGNAL(finished()), this, finishedSlot);
+    parsingFutureWatcher->setFuture(QtConcurrent::run(&myParsingThreadPool, [this, offset, content, createFn]() {
+        QXmlStreamReader xmlStreamReader{content};
+        auto error = false;
+        auto data = (this->*createFn)(xmlStreamReader, error);
+        return std::shared_ptr<ReadyData<T>>{new ReadyData<T>{offset, std::move(data), error}};
+    }));
+}
+
+
+
+template <typename T>
+void Ampache::finishParsing(Event<ReadyData<T>>& readyEvent) {
+    auto parsingFutureWatcher = static_cast<QFutureWatcher<std::shared_ptr<ReadyData<T>>>*>(sender());
+    parsingFutureWatcher->deleteLater();
+
+    auto readyData = parsingFutureWatcher->result();
+    LOG_DBG("Parsing of %d entries from offset %d has finished with error %d.", readyData->data.size(),
+        readyData->offset, readyData->error);
+    if (readyData->error) {
+        myIsInitialized = false;
+    }
+    readyEvent(*readyData);
+}
+
+
+
 void Ampache::IfNoPendingClearFinishedAlbumArtsAndRaiseReady() {
     if (myPendingAlbumArts.empty()) {
         auto finishedAlbumArts = myFinishedAlbumArts;
@@ -645,4 +820,14 @@ std::string Ampache::assembleUrlBase() const {
     return myConnectionInfo.getServerUrl() + "/server/xml.server.php?action=";
 }
 
+
+
+std::pair<std::string, std::string> Ampache::createChangeArgument(Change change,
+    std::chrono::system_clock::time_point since) const {
+
+    auto sinceMSecs = std::chrono::duration_cast<std::chrono::milliseconds>(since.time_since_epoch()).count();
+    auto sinceIso = QDateTime::fromMSecsSinceEpoch(sinceMSecs).toUTC().toString(Qt::ISODate).toStdString();
+    return make_pair(change == Change::Added ? "add" : "update", sinceIso);
+}
+
 }
@@ -37,6 +37,12 @@ std::string AmpacheUrl::parseActionValue() const {
 
 
 
+std::string AmpacheUrl::parseOffsetValue() const {
+    return parseValue(PARAM_OFFSET);
+}
+
+
+
 AmpacheUrl AmpacheUrl::replaceSsidValue(const std::string& newSsidValue) const {
     return replaceValue(PARAM_SSID, newSsidValue);
 }
@@ -98,5 +104,6 @@ const std::string AmpacheUrl::PARAM_AUTH = "auth";
 const std::string AmpacheUrl::PARAM_ID = "id";
 const std::string AmpacheUrl::PARAM_FILTER = "filter";
 const std::string AmpacheUrl::PARAM_ACTION = "action";
+const std::string AmpacheUrl::PARAM_OFFSET = "offset";
 
 }
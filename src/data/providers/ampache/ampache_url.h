@@ -54,6 +54,13 @@ public:
      */
     std::string parseActionValue() const;
 
+    /**
+     * @brief Gets value of parameter 'offset'.
+     *
+     * @return std::string
+     */
+    std::string parseOffsetValue() const;
+
     /**
      * @brief Replaces value of parameter 'ssid' with the given one.
      *
@@ -84,6 +91,7 @@ private:
     static const std::string PARAM_ID;
     static const std::string PARAM_FILTER;
     static const std::string PARAM_ACTION;
+    static const std::string PARAM_OFFSET;
 
     // arguments from the constructor
     const std::string myUrl;
@@ -8,6 +8,8 @@
 
 
 #include <stdio.h>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <memory>
 #include <fstream>
@@ -16,10 +18,12 @@
 #include <utility>
 #include <functional>
 #include <map>
+#include <unordered_map>
 #include <string>
 
 #include <QObject>
 #include <QString>
+#include <QFile>
 #include <QImage>
 #include <QPixmap>
 #include <QFutureWatcher>
@@ -34,6 +38,7 @@
 #include "../data_objects/artist_data.h"
 #include "../data_objects/album_data.h"
 #include "../data_objects/track_data.h"
+#include "data/id_interner.h"
 #include "data/providers/cache.h"
 
 using namespace infrastructure;
@@ -43,6 +48,44 @@ using namespace domain;
 
 namespace data {
 
+Cache::StringPool::StringPool(const char* data, std::uint32_t size):
+myData{data},
+mySize{size} {
+}
+
+
+
+Cache::StringRef Cache::StringPool::add(const std::string& str) {
+    StringRef stringRef{static_cast<std::uint32_t>(myBuffer.size()), static_cast<std::uint32_t>(str.size())};
+    myBuffer += str;
+    myData = myBuffer.data();
+    mySize = myBuffer.size();
+    return stringRef;
+}
+
+
+
+std::string Cache::StringPool::get(StringRef stringRef) const {
+    if (static_cast<std::uint64_t>(stringRef.offset) + stringRef.length > mySize) {
+        return std::string{};
+    }
+    return std::string{myData + stringRef.offset, stringRef.length};
+}
+
+
+
+const char* Cache::StringPool::data() const {
+    return myData;
+}
+
+
+
+std::uint32_t Cache::StringPool::size() const {
+    return mySize;
+}
+
+
+
 #ifdef _WIN32
 #define FSPATH(pathName) filesystem::path{StringEncoding::utf8ToWide(pathName)}
 #else
@@ -54,9 +97,11 @@ namespace data {
 /**
  * @warning Class expects that all save* methods will be called subsequently.
  */
-Cache::Cache(const std::string& serverUrl, const std::string& user):
+Cache::Cache(const std::string& serverUrl, const std::string& user, IdInterner& artistIds, IdInterner& albumIds):
 myCurrentServerUrl{serverUrl},
-myCurrentUser{user} {
+myCurrentUser{user},
+myArtistIds{artistIds},
+myAlbumIds{albumIds} {
     if (!Filesystem::isDirExisting(ALBUM_ARTS_DIR)) {
         Filesystem::makePath(ALBUM_ARTS_DIR, 0700);
         // TODO: Handle errors.
@@ -111,22 +156,12 @@ int Cache::numberOfTracks() const {
 
 std::vector<std::unique_ptr<ArtistData>> Cache::loadArtistsData() const {
     std::vector<std::unique_ptr<ArtistData>> artistsData{};
-    std::ifstream artistsDataStream{std::FSPATH(ARTISTS_DATA_PATH), std::ios::binary };
-    int count = 0;
-    artistsDataStream.read(reinterpret_cast<char*>(&count), sizeof count);
-    for (int idx = 0; idx < count; idx++) {
-        auto id = readString(artistsDataStream);
-        int numberOfAlbums = 0;
-        artistsDataStream.read(reinterpret_cast<char*>(&numberOfAlbums), sizeof numberOfAlbums);
-        int numberOfTracks = 0;
-        artistsDataStream.read(reinterpret_cast<char*>(&numberOfTracks), sizeof numberOfTracks);
-
-        auto name = readString(artistsDataStream);
-
-        artistsData.emplace_back(
-            new ArtistData{id, numberOfAlbums, numberOfTracks, std::unique_ptr<Artist>{new Artist{id, name}}});
-    }
-
+    artistsData.reserve(myNumberOfArtists);
+    readDataFile<ArtistRecord>(ARTISTS_DATA_PATH, [&artistsData](const ArtistRecord& record, const StringPool& pool) {
+        auto id = pool.get(record.id);
+        artistsData.emplace_back(new ArtistData{id, record.numberOfAlbums, record.numberOfTracks,
+            std::unique_ptr<Artist>{new Artist{id, pool.get(record.name)}}});
+    });
     return artistsData;
 }
 
@@ -134,28 +169,16 @@ std::vector<std::unique_ptr<ArtistData>> Cache::loadArtistsData() const {
 
 std::vector<std::unique_ptr<AlbumData>> Cache::loadAlbumsData() const {
     std::vector<std::unique_ptr<AlbumData>> albumsData{};
-
-    std::ifstream albumsDataStream{std::FSPATH(ALBUMS_DATA_PATH), std::ios::binary };
-    int count = 0;
-    albumsDataStream.read(reinterpret_cast<char*>(&count), sizeof count);
-    for (int idx = 0; idx < count; idx++) {
-        auto id = readString(albumsDataStream);
-        auto artUrl = readString(albumsDataStream);
-        auto artistId = readString(albumsDataStream);
-        int numberOfTracks = 0;
-        albumsDataStream.read(reinterpret_cast<char*>(&numberOfTracks), sizeof numberOfTracks);
-
-        auto name = readString(albumsDataStream);
-        int releaseYear = 0;
-        albumsDataStream.read(reinterpret_cast<char*>(&releaseYear), sizeof releaseYear);
-        int mediaNumber = 0;
-        albumsDataStream.read(reinterpret_cast<char*>(&mediaNumber), sizeof mediaNumber);
-
-        albumsData.emplace_back(
-            new AlbumData{id, artUrl, artistId, numberOfTracks, std::unique_ptr<Album>{
-                new Album{id, name, releaseYear, mediaNumber}}});
-    }
-
+    albumsData.reserve(myNumberOfAlbums);
+    std::unordered_map<std::uint64_t, int> artistIdHandles;
+    readDataFile<AlbumRecord>(ALBUMS_DATA_PATH, [this, &albumsData, &artistIdHandles](const AlbumRecord& record,
+        const StringPool& pool) {
+
+        auto id = pool.get(record.id);
+        albumsData.emplace_back(new AlbumData{id, pool.get(record.artUrl),
+            internId(pool, record.artistId, myArtistIds, artistIdHandles), record.numberOfTracks,
+            std::unique_ptr<Album>{new Album{id, pool.get(record.name), record.releaseYear, record.mediaNumber}}});
+    });
     return albumsData;
 }
 
@@ -163,25 +186,17 @@ std::vector<std::unique_ptr<AlbumData>> Cache::loadAlbumsData() const {
 
 std::vector<std::unique_ptr<TrackData>> Cache::loadTracksData() const {
     std::vector<std::unique_ptr<TrackData>> tracksData{};
-
-    std::ifstream tracksDataStream{std::FSPATH(TRACKS_DATA_PATH), std::ios::binary };
-    int count = 0;
-    tracksDataStream.read(reinterpret_cast<char*>(&count), sizeof count);
-    for (int idx = 0; idx < count; idx++) {
-        auto id = readString(tracksDataStream);
-        auto artistId = readString(tracksDataStream);
-        auto albumId = readString(tracksDataStream);
-
-        auto name = readString(tracksDataStream);
-        auto disk = readString(tracksDataStream);
-        int number = 0;
-        tracksDataStream.read(reinterpret_cast<char*>(&number), sizeof number);
-        auto url = readString(tracksDataStream);
-
-        tracksData.emplace_back(
-            new TrackData{id, artistId, albumId, std::unique_ptr<Track>{new Track{id, name, disk, number, url}}});
-    }
-
+    tracksData.reserve(myNumberOfTracks);
+    std::unordered_map<std::uint64_t, int> artistIdHandles;
+    std::unordered_map<std::uint64_t, int> albumIdHandles;
+    readDataFile<TrackRecord>(TRACKS_DATA_PATH, [this, &tracksData, &artistIdHandles, &albumIdHandles](
+        const TrackRecord& record, const StringPool& pool) {
+
+        tracksData.emplace_back(new TrackData{pool.get(record.id),
+            internId(pool, record.artistId, myArtistIds, artistIdHandles),
+            internId(pool, record.albumId, myAlbumIds, albumIdHandles), pool.get(record.name),
+            pool.get(record.disk), record.number, pool.get(record.url)});
+    });
     return tracksData;
 }
 
@@ -199,23 +214,7 @@ void Cache::requestAlbumArts(const std::vector<std::string>& ids) {
 
 
 void Cache::saveArtistsData(std::vector<std::unique_ptr<ArtistData>>& artistsData) {
-    std::ofstream artistsDataStream{std::FSPATH(ARTISTS_DATA_PATH), std::ios::binary | std::ios::trunc };
-    int count = artistsData.size();
-    artistsDataStream.write(reinterpret_cast<char*>(&count), sizeof count);
-    for (auto& artistData: artistsData) {
-        std::string id = artistData->getId();
-        int numberOfAlbums = artistData->getNumberOfAlbums();
-        int numberOfTracks = artistData->getNumberOfTracks();
-
-        auto& artist = artistData->getArtist();
-        std::string name = artist.getName();
-
-        writeString(artistsDataStream, id);
-        artistsDataStream.write(reinterpret_cast<char*>(&numberOfAlbums), sizeof numberOfAlbums);
-        artistsDataStream.write(reinterpret_cast<char*>(&numberOfTracks), sizeof numberOfTracks);
-        writeString(artistsDataStream, name);
-    }
-    myNumberOfArtists = count;
+    myNumberOfArtists = writeArtistsData(artistsData);
     myArtistsSaved = true;
     updateLastUpdateInfo();
 }
@@ -223,29 +222,7 @@ void Cache::saveArtistsData(std::vector<std::unique_ptr<ArtistData>>& artistsDat
 
 
 void Cache::saveAlbumsData(std::vector<std::unique_ptr<AlbumData>>& albumsData) {
-    std::ofstream albumsDataStream{std::FSPATH(ALBUMS_DATA_PATH), std::ios::binary | std::ios::trunc };
-    int count = albumsData.size();
-    albumsDataStream.write(reinterpret_cast<char*>(&count), sizeof count);
-    for (auto& albumData: albumsData) {
-        std::string id = albumData->getId();
-        std::string artUrl = albumData->getArtUrl();
-        std::string artistId = albumData->getArtistId();
-        int numberOfTracks = albumData->getNumberOfTracks();
-
-        auto& album = albumData->getAlbum();
-        std::string name = album.getName();
-        int releaseYear = album.getReleaseYear();
-        int mediaNumber = album.getMediaNumber();
-
-        writeString(albumsDataStream, id);
-        writeString(albumsDataStream, artUrl);
-        writeString(albumsDataStream, artistId);
-        albumsDataStream.write(reinterpret_cast<char*>(&numberOfTracks), sizeof numberOfTracks);
-        writeString(albumsDataStream, name);
-        albumsDataStream.write(reinterpret_cast<char*>(&releaseYear), sizeof releaseYear);
-        albumsDataStream.write(reinterpret_cast<char*>(&mediaNumber), sizeof mediaNumber);
-    }
-    myNumberOfAlbums = count;
+    myNumberOfAlbums = writeAlbumsData(albumsData);
     myAlbumsSaved = true;
     updateLastUpdateInfo();
 }
@@ -253,35 +230,41 @@ void Cache::saveAlbumsData(std::vector<std::unique_ptr<AlbumData>>& albumsData)
 
 
 void Cache::saveTracksData(std::vector<std::unique_ptr<TrackData>>& tracksData) {
-    std::ofstream tracksDataStream{std::FSPATH(TRACKS_DATA_PATH), std::ios::binary | std::ios::trunc };
-    int count = tracksData.size();
-    tracksDataStream.write(reinterpret_cast<char*>(&count), sizeof count);
-    for (auto& trackData: tracksData) {
-        std::string id = trackData->getId();
-        std::string artistId = trackData->getArtistId();
-        std::string albumId = trackData->getAlbumId();
-
-        auto& track = trackData->getTrack();
-        std::string name = track.getName();
-        std::string disk = track.getDisk();
-        int number = track.getNumber();
-        std::string url = track.getUrl();
-
-        writeString(tracksDataStream, id);
-        writeString(tracksDataStream, artistId);
-        writeString(tracksDataStream, albumId);
-        writeString(tracksDataStream, name);
-        writeString(tracksDataStream, disk);
-        tracksDataStream.write(reinterpret_cast<char*>(&number), sizeof number);
-        writeString(tracksDataStream, url);
-    }
-    myNumberOfTracks = count;
+    myNumberOfTracks = writeTracksData(tracksData);
     myTracksSaved = true;
     updateLastUpdateInfo();
 }
 
 
 
+void Cache::mergeData(std::vector<std::unique_ptr<ArtistData>>& artistsData,
+    std::vector<std::unique_ptr<AlbumData>>& albumsData, std::vector<std::unique_ptr<TrackData>>& tracksData,
+    std::chrono::system_clock::time_point updateBegin) {
+
+    LOG_DBG("Merging %d artists, %d albums and %d tracks.", artistsData.size(), albumsData.size(), tracksData.size());
+
+    // changed album may have a different art
+    for (auto& albumData: albumsData) {
+        QFile::remove(QString::fromStdString(ALBUM_ARTS_DIR + albumData->getId() + ART_SUFFIX));
+    }
+
+    auto cachedArtistsData = loadArtistsData();
+    mergeById(cachedArtistsData, artistsData);
+    myNumberOfArtists = writeArtistsData(cachedArtistsData);
+
+    auto cachedAlbumsData = loadAlbumsData();
+    mergeById(cachedAlbumsData, albumsData);
+    myNumberOfAlbums = writeAlbumsData(cachedAlbumsData);
+
+    auto cachedTracksData = loadTracksData();
+    mergeById(cachedTracksData, tracksData);
+    myNumberOfTracks = writeTracksData(cachedTracksData);
+
+    saveMeta(updateBegin);
+}
+
+
+
 void Cache::updateAlbumArts(const std::map<std::string, QPixmap>& arts) const {
     for (auto idAndArt: arts) {
         idAndArt.second.save(QString::fromStdString(ALBUM_ARTS_DIR + idAndArt.first + ART_SUFFIX), "PNG");
@@ -308,6 +291,106 @@ void Cache::onArtsLoadFinished() {
 
 
 
+int Cache::writeArtistsData(const std::vector<std::unique_ptr<ArtistData>>& artistsData) const {
+    StringPool pool;
+    std::vector<ArtistRecord> records;
+    records.reserve(artistsData.size());
+    for (auto& artistData: artistsData) {
+        auto& artist = artistData->getArtist();
+        records.push_back(ArtistRecord{pool.add(artistData->getId()), artistData->getNumberOfAlbums(),
+            artistData->getNumberOfTracks(), pool.add(artist.getName())});
+    }
+    writeDataFile(ARTISTS_DATA_PATH, records, pool);
+    return records.size();
+}
+
+
+
+int Cache::writeAlbumsData(const std::vector<std::unique_ptr<AlbumData>>& albumsData) const {
+    StringPool pool;
+    std::unordered_map<int, StringRef> artistIds;
+    std::vector<AlbumRecord> records;
+    records.reserve(albumsData.size());
+    for (auto& albumData: albumsData) {
+        auto& album = albumData->getAlbum();
+        records.push_back(AlbumRecord{pool.add(albumData->getId()), pool.add(albumData->getArtUrl()),
+            addId(pool, myArtistIds, albumData->getArtistIdHandle(), artistIds), albumData->getNumberOfTracks(),
+            pool.add(album.getName()), album.getReleaseYear(), album.getMediaNumber()});
+    }
+    writeDataFile(ALBUMS_DATA_PATH, records, pool);
+    return records.size();
+}
+
+
+
+int Cache::writeTracksData(const std::vector<std::unique_ptr<TrackData>>& tracksData) const {
+    StringPool pool;
+    std::unordered_map<int, StringRef> artistIds;
+    std::unordered_map<int, StringRef> albumIds;
+    std::vector<TrackRecord> records;
+    records.reserve(tracksData.size());
+    for (auto& trackData: tracksData) {
+        auto& track = trackData->getTrack();
+        records.push_back(TrackRecord{pool.add(trackData->getId()),
+            addId(pool, myArtistIds, trackData->getArtistIdHandle(), artistIds),
+            addId(pool, myAlbumIds, trackData->getAlbumIdHandle(), albumIds), pool.add(track.getName()),
+            pool.add(track.getDisk()), track.getNumber(), pool.add(track.getUrl())});
+    }
+    writeDataFile(TRACKS_DATA_PATH, records, pool);
+    return records.size();
+}
+
+
+
+// IDs of artists and albums are repeated in many records; each of them is looked up in the interner and stored in the
+// pool only once
+Cache::StringRef Cache::addId(StringPool& pool, const IdInterner& ids, int idHandle,
+    std::unordered_map<int, StringRef>& pooledIds) {
+
+    auto pooledIdIter = pooledIds.find(idHandle);
+    if (pooledIdIter == pooledIds.end()) {
+        pooledIdIter = pooledIds.emplace(idHandle, pool.add(ids.getId(idHandle))).first;
+    }
+    return pooledIdIter->second;
+}
+
+
+
+// IDs stored by addId() are shared by the records so each of them is read and interned only once
+int Cache::internId(const StringPool& pool, StringRef id, IdInterner& ids,
+    std::unordered_map<std::uint64_t, int>& idHandles) {
+
+    auto key = static_cast<std::uint64_t>(id.offset) << 32 | id.length;
+    auto idHandleIter = idHandles.find(key);
+    if (idHandleIter == idHandles.end()) {
+        idHandleIter = idHandles.emplace(key, ids.intern(pool.get(id))).first;
+    }
+    return idHandleIter->second;
+}
+
+
+
+template <typename T>
+void Cache::mergeById(std::vector<std::unique_ptr<T>>& data, std::vector<std::unique_ptr<T>>& changedData) const {
+    std::unordered_map<std::string, int> offsets;
+    for (int idx = 0; idx < static_cast<int>(data.size()); idx++) {
+        offsets.emplace(data[idx]->getId(), idx);
+    }
+
+    for (auto& changedDataItem: changedData) {
+        auto offsetsIter = offsets.find(changedDataItem->getId());
+        if (offsetsIter != offsets.end()) {
+            data[offsetsIter->second] = std::move(changedDataItem);
+        } else {
+            offsets.emplace(changedDataItem->getId(), data.size());
+            data.push_back(std::move(changedDataItem));
+        }
+    }
+    changedData.clear();
+}
+
+
+
 bool Cache::loadMeta(std::ifstream& metaStream) {
     int version = 0;
     metaStream.read(reinterpret_cast<char*>(&version), sizeof version);
@@ -381,6 +464,61 @@ void Cache::writeString(std::ofstream& stream, const std::string& str) const {
 
 
 
+template <typename R>
+void Cache::readDataFile(const std::string& path,
+    const std::function<void(const R& record, const StringPool& pool)>& processRecord) const {
+
+    QFile dataFile{QString::fromStdString(path)};
+    if (!dataFile.open(QIODevice::ReadOnly)) {
+        LOG_WARN("Unable to open cache data file '%s'.", path.c_str());
+        return;
+    }
+
+    auto fileSize = static_cast<std::uint64_t>(dataFile.size());
+    DataFileHeader header{};
+    if (fileSize < sizeof header) {
+        LOG_WARN("Cache data file '%s' is corrupted.", path.c_str());
+        return;
+    }
+    auto content = dataFile.map(0, fileSize);
+    if (content == nullptr) {
+        LOG_WARN("Unable to map cache data file '%s'.", path.c_str());
+        return;
+    }
+
+    std::memcpy(&header, content, sizeof header);
+    auto recordsSize = static_cast<std::uint64_t>(header.count) * sizeof(R);
+    if (fileSize != sizeof header + recordsSize + header.stringPoolSize) {
+        LOG_WARN("Cache data file '%s' is corrupted.", path.c_str());
+        dataFile.unmap(content);
+        return;
+    }
+
+    auto records = content + sizeof header;
+    StringPool pool{reinterpret_cast<const char*>(records + recordsSize), header.stringPoolSize};
+    R record{};
+    for (std::uint32_t idx = 0; idx < header.count; idx++) {
+        // records are copied out of the mapped memory since their alignment is not guaranteed
+        std::memcpy(&record, records + idx * sizeof(R), sizeof(R));
+        processRecord(record, pool);
+    }
+
+    dataFile.unmap(content);
+}
+
+
+
+template <typename R>
+void Cache::writeDataFile(const std::string& path, const std::vector<R>& records, const StringPool& pool) const {
+    std::ofstream dataStream{std::FSPATH(path), std::ios::binary | std::ios::trunc };
+    DataFileHeader header{static_cast<std::uint32_t>(records.size()), pool.size()};
+    dataStream.write(reinterpret_cast<const char*>(&header), sizeof header);
+    dataStream.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(R));
+    dataStream.write(pool.data(), pool.size());
+}
+
+
+
 void Cache::updateLastUpdateInfo() {
     if (myArtistsSaved + myAlbumsSaved + myTracksSaved == 1) {
         invalidate();
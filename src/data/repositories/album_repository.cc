@@ -25,6 +25,7 @@
 #include "data/provider_type.h"
 #include "data/providers/ampache/ampache.h"
 #include "data/providers/cache.h"
+#include "data/id_interner.h"
 #include "../data_objects/album_data.h"
 #include "data/indices.h"
 #include "data/repositories/repository.h"
@@ -38,8 +39,9 @@ using namespace domain;
 
 namespace data {
 
-AlbumRepository::AlbumRepository(Ampache& ampache, Cache& cache, Indices& indices,
-    const ArtistRepository* const artistRepository): Repository<AlbumData, Album>(ampache, cache, indices),
+AlbumRepository::AlbumRepository(Ampache& ampache, Cache& cache, Indices& indices, IdInterner& albumIds,
+    const ArtistRepository* const artistRepository):
+Repository<AlbumData, Album>(ampache, cache, indices, &albumIds),
 myArtistRepository(artistRepository) {
     myAmpache.readyAlbumArts += DELEGATE1(&AlbumRepository::onAmpacheReadyArts, std::map<std::string, QPixmap>);
     myCache.readyAlbumArts += DELEGATE1(&AlbumRepository::onCacheReadyArts, std::map<std::string, QPixmap>);
@@ -72,17 +74,19 @@ Album& AlbumRepository::getUnfiltered(int offset) const {
 
 
 AlbumData* AlbumRepository::getAlbumDataById(const std::string& id) const {
-    auto albumsDataIter = find_if(myData.begin(), myData.end(),
-        [&id](const std::unique_ptr<AlbumData>& ad) {return ad != nullptr && ad->getId() == id;});
-    return albumsDataIter != myData.end() ? albumsDataIter->get() : nullptr;
+    return getDataById(id);
+}
+
+
+
+AlbumData* AlbumRepository::getAlbumDataByIdHandle(int idHandle) const {
+    return getDataByIdHandle(idHandle);
 }
 
 
 
 bool AlbumRepository::isLoadedUnfiltered(int offset, int count) const {
-    uint end = offset + count;
-    return (myData.size() >= end) && all_of(myData.begin() + offset,
-        myData.begin() + offset + count, [](const std::unique_ptr<AlbumData>& d) {return d != nullptr;});
+    return myLoadedOffsets.contains(offset, count);
 }
 
 
@@ -183,7 +187,7 @@ Album& AlbumRepository::getDomainObject(const AlbumData& dataItem) const {
 
 
 
-Event<std::pair<std::vector<std::unique_ptr<AlbumData>>, bool>>& AlbumRepository::getDataLoadRequestFinishedEvent() {
+Event<ReadyData<AlbumData>>& AlbumRepository::getDataLoadRequestFinishedEvent() {
     return myAmpache.readyAlbums;
 }
 
@@ -203,7 +207,7 @@ void AlbumRepository::saveDataToCache() {
 
 void AlbumRepository::handleLoadedItem(const AlbumData& dataItem) const {
     if (dataItem.hasArtist()) {
-        auto artist = myArtistRepository->getById(dataItem.getArtistId());
+        auto artist = myArtistRepository->getByIdHandle(dataItem.getArtistIdHandle());
         if (artist != nullptr) {
             dataItem.getAlbum().setArtist(*artist);
         }
@@ -216,15 +220,18 @@ void AlbumRepository::updateIndices(const std::vector<std::unique_ptr<AlbumData>
     std::vector<std::reference_wrapper<Album>> albums;
     ArtistAlbumsIndex artistAlbums;
     for (auto& dataItem: data) {
+        if (dataItem == nullptr) {
+            continue;
+        }
         albums.push_back(dataItem->getAlbum());
         if (dataItem->hasArtist()) {
 
             // Ampache (3.7.0) seems to ignore Album Artist info.  Only single-artist albums have Artist ID set.  Albums
             // with various artists does not (even if the Album Artist is set in the track's tags).  Therefore
             // this code is redundand; it is kept however in case Ampache is fixed.
-            auto artist = myArtistRepository->getById(dataItem->getArtistId());
+            auto artist = myArtistRepository->getByIdHandle(dataItem->getArtistIdHandle());
             if (artist != nullptr) {
-                artistAlbums[*artist].insert(*dataItem);
+                artistAlbums.emplace_back(dataItem->getArtistIdHandle(), dataItem.get());
             }
         }
     }
@@ -365,7 +372,7 @@ std::pair<std::map<std::string, QPixmap>, std::map<std::string, std::string>> Al
 
 
 AlbumData* AlbumRepository::findAlbumDataById(const std::string& id, int filteredOffset, int count) const {
-    auto filteredAlbumsData = myFilter->getFilteredData();
+    auto& filteredAlbumsData = myFilter->getFilteredData();
     auto albumDataIter = find_if(filteredAlbumsData.begin() + filteredOffset,
         filteredAlbumsData.begin() + filteredOffset + count,
         [&id](AlbumData* ad) {return ad->getId() == id;});
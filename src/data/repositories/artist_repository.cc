@@ -19,6 +19,7 @@
 #include "data/providers/cache.h"
 #include "../data_objects/artist_data.h"
 #include "data/indices.h"
+#include "data/id_interner.h"
 #include "data/repositories/repository.h"
 #include "data/repositories/artist_repository.h"
 
@@ -29,8 +30,8 @@ using namespace domain;
 
 namespace data {
 
-ArtistRepository::ArtistRepository(Ampache& ampache, Cache& cache, Indices& indices):
-Repository<ArtistData, Artist>(ampache, cache, indices) {
+ArtistRepository::ArtistRepository(Ampache& ampache, Cache& cache, Indices& indices, IdInterner& artistIds):
+Repository<ArtistData, Artist>(ampache, cache, indices, &artistIds) {
 }
 
 
@@ -59,7 +60,7 @@ Artist& ArtistRepository::getDomainObject(const data::ArtistData& dataItem) cons
 
 
 
-Event<std::pair<std::vector<std::unique_ptr<ArtistData>>, bool>>& ArtistRepository::getDataLoadRequestFinishedEvent() {
+Event<ReadyData<ArtistData>>& ArtistRepository::getDataLoadRequestFinishedEvent() {
     return myAmpache.readyArtists;
 }
 
@@ -80,6 +81,9 @@ void ArtistRepository::saveDataToCache() {
 void ArtistRepository::updateIndices(const std::vector<std::unique_ptr<ArtistData>>& data) {
     std::vector<std::reference_wrapper<Artist>> artists;
     for (auto& dataItem: data) {
+        if (dataItem == nullptr) {
+            continue;
+        }
         artists.push_back(dataItem->getArtist());
     }
     myIndices.addArtists(artists);
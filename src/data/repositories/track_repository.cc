@@ -64,7 +64,7 @@ Track& TrackRepository::getDomainObject(const data::TrackData& dataItem) const {
 
 
 
-Event<std::pair<std::vector<std::unique_ptr<TrackData>>, bool>>& TrackRepository::getDataLoadRequestFinishedEvent() {
+Event<ReadyData<TrackData>>& TrackRepository::getDataLoadRequestFinishedEvent() {
     return myAmpache.readyTracks;
 }
 
@@ -86,11 +86,11 @@ void TrackRepository::handleLoadedItem(const TrackData& dataItem) const {
     data::Repository<data::TrackData, domain::Track>::handleLoadedItem(dataItem);
 
     auto& track = dataItem.getTrack();
-    auto artist = myArtistRepository->getById(dataItem.getArtistId());
+    auto artist = myArtistRepository->getByIdHandle(dataItem.getArtistIdHandle());
     if (artist != nullptr) {
         track.setArtist(*artist);
     }
-    auto album = myAlbumRepository->getById(dataItem.getAlbumId());
+    auto album = myAlbumRepository->getByIdHandle(dataItem.getAlbumIdHandle());
     if (album != nullptr) {
         track.setAlbum(*album);
     }
@@ -103,17 +103,21 @@ void TrackRepository::updateIndices(const std::vector<std::unique_ptr<TrackData>
     ArtistTracksIndex artistTracks;
     AlbumTracksIndex albumTracks;
     for (auto& dataItem: data) {
-        auto artist = myArtistRepository->getById(dataItem->getArtistId());
-        auto albumData = myAlbumRepository->getAlbumDataById(dataItem->getAlbumId());
+        if (dataItem == nullptr) {
+            continue;
+        }
+        auto artistIdHandle = dataItem->getArtistIdHandle();
+        auto albumIdHandle = dataItem->getAlbumIdHandle();
+        auto artist = myArtistRepository->getByIdHandle(artistIdHandle);
+        auto albumData = myAlbumRepository->getAlbumDataByIdHandle(albumIdHandle);
         if (artist != nullptr) {
             if (albumData != nullptr) {
-                artistAlbums[*artist].insert(*albumData);
+                artistAlbums.emplace_back(artistIdHandle, albumData);
             }
-            artistTracks[*artist].insert(*dataItem);
+            artistTracks.emplace_back(artistIdHandle, dataItem.get());
         }
         if (albumData != nullptr) {
-            auto& album = albumData->getAlbum();
-            albumTracks[album].insert(*dataItem);
+            albumTracks.emplace_back(albumIdHandle, dataItem.get());
         }
     }
 
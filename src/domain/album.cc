@@ -33,13 +33,13 @@ myMediaNumber{mediaNumber} {
 
 
 
-const std::string Album::getId() const {
+const std::string& Album::getId() const {
     return myId;
 }
 
 
 
-const std::string Album::getName() const {
+const std::string& Album::getName() const {
     return myName;
 }
 
@@ -23,13 +23,13 @@ myName{name} {
 
 
 
-const std::string Artist::getId() const {
+const std::string& Artist::getId() const {
     return myId;
 }
 
 
 
-const std::string Artist::getName() const {
+const std::string& Artist::getName() const {
     return myName;
 }
 
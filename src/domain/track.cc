@@ -31,19 +31,19 @@ myUrl{url} { }
 
 
 
-const std::string Track::getId() const {
+const std::string& Track::getId() const {
     return myId;
 }
 
 
 
-const std::string Track::getName() const {
+const std::string& Track::getName() const {
     return myName;
 }
 
 
 
-const std::string Track::getDisk() const {
+const std::string& Track::getDisk() const {
     return myDisk;
 }
 
@@ -55,7 +55,7 @@ int Track::getNumber() const {
 
 
 
-const std::string Track::getUrl() const {
+const std::string& Track::getUrl() const {
     return myUrl;
 }
 
@@ -0,0 +1,217 @@
+// case_insensitive_search.cc
+//
+// Project: Ampache Browser
+// License: GNU GPLv3
+//
+// Copyright (C) 2026 Róbert Čerňanský
+
+
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define X86_SIMD
+#include <immintrin.h>
+#endif
+
+#include "infrastructure/case_insensitive_search.h"
+
+
+
+namespace infrastructure {
+
+using ContainsFn = bool (*)(const unsigned char* str, size_t strLength, const unsigned char* foldedPattern,
+    size_t patternLength);
+
+
+
+// converts ASCII lower case letters to upper case; leaves other characters intact
+static inline unsigned char foldCase(unsigned char c) {
+    return static_cast<unsigned int>(c - 'a') < 26 ? c - ('a' - 'A') : c;
+}
+
+
+
+static inline bool isMatchingAt(const unsigned char* str, const unsigned char* foldedPattern, size_t patternLength) {
+    for (size_t idx = 0; idx < patternLength; idx++) {
+        if (foldCase(str[idx]) != foldedPattern[idx]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+static bool containsFrom(const unsigned char* str, size_t strLength, const unsigned char* foldedPattern,
+    size_t patternLength, size_t begin) {
+
+    for (auto pos = begin; pos + patternLength <= strLength; pos++) {
+        if (isMatchingAt(str + pos, foldedPattern, patternLength)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+
+static bool containsScalar(const unsigned char* str, size_t strLength, const unsigned char* foldedPattern,
+    size_t patternLength) {
+
+    return containsFrom(str, strLength, foldedPattern, patternLength, 0);
+}
+
+
+
+#ifdef X86_SIMD
+
+// positions where the first and the last character of the pattern match are found for a whole block of the string at
+// once; only those positions are then compared with the whole pattern
+
+// size of the buffer for the end of the string which is shorter than a block
+static const size_t TAIL_BUFFER_SIZE = 64;
+
+__attribute__((target("sse2")))
+static inline __m128i foldCaseSse2(__m128i chars) {
+    auto isLower = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('a' - 1)),
+        _mm_cmplt_epi8(chars, _mm_set1_epi8('z' + 1)));
+    return _mm_sub_epi8(chars, _mm_and_si128(isLower, _mm_set1_epi8('a' - 'A')));
+}
+
+
+
+__attribute__((target("sse2")))
+static inline unsigned int findCandidatesSse2(const unsigned char* block, size_t patternLength, __m128i first,
+    __m128i last) {
+
+    auto firstBlock = foldCaseSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)));
+    auto lastBlock = foldCaseSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + patternLength - 1)));
+    return _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(firstBlock, first), _mm_cmpeq_epi8(lastBlock, last)));
+}
+
+
+
+__attribute__((target("sse2")))
+static bool containsSse2(const unsigned char* str, size_t strLength, const unsigned char* foldedPattern,
+    size_t patternLength) {
+
+    auto first = _mm_set1_epi8(static_cast<char>(foldedPattern[0]));
+    auto last = _mm_set1_epi8(static_cast<char>(foldedPattern[patternLength - 1]));
+    size_t pos = 0;
+    for (; pos + patternLength - 1 + 16 <= strLength; pos += 16) {
+        auto mask = findCandidatesSse2(str + pos, patternLength, first, last);
+        while (mask != 0) {
+            if (isMatchingAt(str + pos + __builtin_ctz(mask), foldedPattern, patternLength)) {
+                return true;
+            }
+            mask &= mask - 1;
+        }
+    }
+    if (pos + patternLength > strLength) {
+        return false;
+    }
+
+    // the rest of the string (most of the names are shorter than a block) is copied to a buffer so that a whole block
+    // can be loaded; positions beyond the rest are masked out
+    unsigned char buffer[TAIL_BUFFER_SIZE];
+    auto restLength = strLength - pos;
+    if (restLength > sizeof(buffer) - 16) {
+        return containsFrom(str, strLength, foldedPattern, patternLength, pos);
+    }
+    memcpy(buffer, str + pos, restLength);
+    memset(buffer + restLength, 0, sizeof(buffer) - restLength);
+    auto mask = findCandidatesSse2(buffer, patternLength, first, last) & ((1u << (restLength - patternLength + 1)) - 1);
+    while (mask != 0) {
+        if (isMatchingAt(buffer + __builtin_ctz(mask), foldedPattern, patternLength)) {
+            return true;
+        }
+        mask &= mask - 1;
+    }
+    return false;
+}
+
+
+
+__attribute__((target("avx2")))
+static inline __m256i foldCaseAvx2(__m256i chars) {
+    auto isLower = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('a' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), chars));
+    return _mm256_sub_epi8(chars, _mm256_and_si256(isLower, _mm256_set1_epi8('a' - 'A')));
+}
+
+
+
+__attribute__((target("avx2")))
+static bool containsAvx2(const unsigned char* str, size_t strLength, const unsigned char* foldedPattern,
+    size_t patternLength) {
+
+    auto first = _mm256_set1_epi8(static_cast<char>(foldedPattern[0]));
+    auto last = _mm256_set1_epi8(static_cast<char>(foldedPattern[patternLength - 1]));
+    size_t pos = 0;
+    for (; pos + patternLength - 1 + 32 <= strLength; pos += 32) {
+        auto firstBlock = foldCaseAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos)));
+        auto lastBlock = foldCaseAvx2(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(str + pos + patternLength - 1)));
+        unsigned int mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(firstBlock, first),
+            _mm256_cmpeq_epi8(lastBlock, last)));
+        while (mask != 0) {
+            if (isMatchingAt(str + pos + __builtin_ctz(mask), foldedPattern, patternLength)) {
+                return true;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    // the rest is shorter than a block of AVX2 but it still can be longer than a block of SSE2
+    return containsSse2(str + pos, strLength - pos, foldedPattern, patternLength);
+}
+
+#endif
+
+
+
+static ContainsFn selectContainsFn() {
+#ifdef X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return containsAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return containsSse2;
+    }
+#endif
+    return containsScalar;
+}
+
+
+
+// the implementation for the processor the application runs on
+static const ContainsFn containsFn = selectContainsFn();
+
+
+
+CaseInsensitiveSearch::CaseInsensitiveSearch(const std::string& pattern):
+myFoldedPattern(pattern) {
+    for (auto& c: myFoldedPattern) {
+        c = static_cast<char>(foldCase(static_cast<unsigned char>(c)));
+    }
+}
+
+
+
+bool CaseInsensitiveSearch::isFoundIn(std::string_view str) const {
+    if (myFoldedPattern.empty()) {
+        return !str.empty();
+    }
+    if (str.size() < myFoldedPattern.size()) {
+        return false;
+    }
+    return containsFn(reinterpret_cast<const unsigned char*>(str.data()), str.size(),
+        reinterpret_cast<const unsigned char*>(myFoldedPattern.data()), myFoldedPattern.size());
+}
+
+}
@@ -23,6 +23,7 @@
 #include <QItemSelection>
 #include <QLineEdit>
 #include <QCompleter>
+#include <QTimer>
 
 #include "settings_dialog.h"
 #include "ampache_browser_main_window.h"
@@ -35,8 +36,18 @@ class QWidget;
 
 namespace ui {
 
+// delay of the search after the search text was changed (in milliseconds); changes within the delay are coalesced
+static const int SEARCH_DELAY = 250;
+
+
+
 Ui::Ui():
-myMainWindow{new AmpacheBrowserMainWindow{}} {
+myMainWindow{new AmpacheBrowserMainWindow{}},
+mySearchTimer{new QTimer{this}} {
+    mySearchTimer->setSingleShot(true);
+    mySearchTimer->setInterval(SEARCH_DELAY);
+    connect(mySearchTimer, SIGNAL(timeout()), this, SLOT(onSearchTimerTimeout()));
+
     connect(myMainWindow->playAction, SIGNAL(triggered()), this, SLOT(onPlayActionTriggered()));
     connect(myMainWindow->createPlaylistAction, SIGNAL(triggered()), this, SLOT(onCreatePlaylistActionTriggered()));
     connect(myMainWindow->addToPlaylistAction, SIGNAL(triggered()), this, SLOT(onAddToPlaylistActionTriggered()));
@@ -170,17 +181,24 @@ void Ui::onTracksSelectionModelSelectionChanged(const QItemSelection&, const QIt
 
 
 void Ui::onSearchTextChanged(const QString& searchText) {
-    auto stdSearchText = searchText.toStdString();
-    searchTriggered(stdSearchText);
-    enableOrDisablePlayActions();
+    // clearing of the search is not delayed; the filters shall be unset before e. g. the data are reloaded
+    if (searchText.isEmpty()) {
+        triggerSearch();
+    } else {
+        mySearchTimer->start();
+    }
 }
 
 
 
 void Ui::onSearchReturnPressed() {
-    auto searchText = myMainWindow->searchLineEdit->text().toStdString();
-    searchTriggered(searchText);
-    enableOrDisablePlayActions();
+    triggerSearch();
+}
+
+
+
+void Ui::onSearchTimerTimeout() {
+    triggerSearch();
 }
 
 
@@ -195,6 +213,15 @@ void Ui::onSettingsAccepted() {
 
 
 
+void Ui::triggerSearch() {
+    mySearchTimer->stop();
+    auto searchText = myMainWindow->searchLineEdit->text().toStdString();
+    searchTriggered(searchText);
+    enableOrDisablePlayActions();
+}
+
+
+
 SelectedItems Ui::getSelectedItems() const {
     std::vector<std::string> artistIds;
     for (auto hiddenArtistColumnIndex: getAristSelectedRows()) {